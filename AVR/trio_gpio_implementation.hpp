@@ -37,18 +37,130 @@
 #define TRIO_AVR_PORT_
 //#define TRIO_XMEGA_PORT_
 
+/*PINx toggle capability
+* Most AVRs toggle PORTx bits when 1 is written to PINx. It is one OUT/STS instead of read-modify-write and it is atomic.
+* Old parts(ATmega8/16/32/64/103/128, ATmega161/162/163/323, ATmega8515/8535, ATtiny11/12/15/22/26/28, AT90S, AT90C,
+* AT43USB, AT76C711, AT86RF401) don't have it: their PINx is read only and Toggle() falls back to read-modify-write.
+* Define TRIO_AVR_HAS_PINX_TOGGLE to 0 or 1 to override detection*/
+#ifndef TRIO_AVR_HAS_PINX_TOGGLE
+    #if defined(__AVR_ATmega8__) || defined(__AVR_ATmega8A__) || defined(__AVR_ATmega16__) || defined(__AVR_ATmega16A__) \
+        || defined(__AVR_ATmega32__) || defined(__AVR_ATmega32A__) || defined(__AVR_ATmega64__) || defined(__AVR_ATmega64A__) \
+        || defined(__AVR_ATmega128__) || defined(__AVR_ATmega128A__) || defined(__AVR_ATmega8515__) || defined(__AVR_ATmega8535__) \
+        || defined(__AVR_ATmega162__) || defined(__AVR_ATmega161__) || defined(__AVR_ATmega163__) || defined(__AVR_ATmega323__) \
+        || defined(__AVR_ATmega103__) || defined(__AVR_ATtiny26__) || defined(__AVR_ATtiny15__) || defined(__AVR_ATtiny12__) \
+        || defined(__AVR_ATtiny11__) || defined(__AVR_ATtiny22__) || defined(__AVR_ATtiny28__) \
+        || defined(__AVR_AT90S1200__) || defined(__AVR_AT90S2313__) || defined(__AVR_AT90S2323__) || defined(__AVR_AT90S2333__) \
+        || defined(__AVR_AT90S2343__) || defined(__AVR_AT90S4414__) || defined(__AVR_AT90S4433__) || defined(__AVR_AT90S4434__) \
+        || defined(__AVR_AT90S8515__) || defined(__AVR_AT90S8535__) || defined(__AVR_AT90C8534__) \
+        || defined(__AVR_AT43USB320__) || defined(__AVR_AT43USB355__) || defined(__AVR_AT76C711__) || defined(__AVR_AT86RF401__)
+        #define TRIO_AVR_HAS_PINX_TOGGLE 0
+    #else
+        #define TRIO_AVR_HAS_PINX_TOGGLE 1
+    #endif
+#endif
+
+/*Pin change interrupts(PCINT)
+* Port which pins map 1:1 to PCMSKn bits enables and disables pin interrupts by Configure::EnableInterrupt/DisableInterrupt:
+* pins are set in PCMSKn and PCIEn is set in PCICR(GIMSK on ATtiny).
+* Define TRIO_AVR_PCINT_x(x is port letter) to PCINT group number to override detection, -1 means no PCINT group*/
+#if defined(__AVR_ATmega48__) || defined(__AVR_ATmega48A__) || defined(__AVR_ATmega48P__) || defined(__AVR_ATmega48PA__) \
+    || defined(__AVR_ATmega88__) || defined(__AVR_ATmega88A__) || defined(__AVR_ATmega88P__) || defined(__AVR_ATmega88PA__) \
+    || defined(__AVR_ATmega168__) || defined(__AVR_ATmega168A__) || defined(__AVR_ATmega168P__) || defined(__AVR_ATmega168PA__) \
+    || defined(__AVR_ATmega328__) || defined(__AVR_ATmega328P__)
+    #ifndef TRIO_AVR_PCINT_B
+        #define TRIO_AVR_PCINT_B 0
+    #endif
+    #ifndef TRIO_AVR_PCINT_C
+        #define TRIO_AVR_PCINT_C 1
+    #endif
+    #ifndef TRIO_AVR_PCINT_D
+        #define TRIO_AVR_PCINT_D 2
+    #endif
+#elif defined(__AVR_ATmega164A__) || defined(__AVR_ATmega164P__) || defined(__AVR_ATmega164PA__) \
+    || defined(__AVR_ATmega324A__) || defined(__AVR_ATmega324P__) || defined(__AVR_ATmega324PA__) \
+    || defined(__AVR_ATmega644__) || defined(__AVR_ATmega644A__) || defined(__AVR_ATmega644P__) || defined(__AVR_ATmega644PA__) \
+    || defined(__AVR_ATmega1284__) || defined(__AVR_ATmega1284P__)
+    #ifndef TRIO_AVR_PCINT_A
+        #define TRIO_AVR_PCINT_A 0
+    #endif
+    #ifndef TRIO_AVR_PCINT_B
+        #define TRIO_AVR_PCINT_B 1
+    #endif
+    #ifndef TRIO_AVR_PCINT_C
+        #define TRIO_AVR_PCINT_C 2
+    #endif
+    #ifndef TRIO_AVR_PCINT_D
+        #define TRIO_AVR_PCINT_D 3
+    #endif
+#elif defined(__AVR_ATtiny24__) || defined(__AVR_ATtiny24A__) || defined(__AVR_ATtiny44__) || defined(__AVR_ATtiny44A__) \
+    || defined(__AVR_ATtiny84__) || defined(__AVR_ATtiny84A__)
+    #ifndef TRIO_AVR_PCINT_A
+        #define TRIO_AVR_PCINT_A 0
+    #endif
+    #ifndef TRIO_AVR_PCINT_B
+        #define TRIO_AVR_PCINT_B 1
+    #endif
+#elif defined(__AVR_ATtiny25__) || defined(__AVR_ATtiny45__) || defined(__AVR_ATtiny85__) || defined(__AVR_ATtiny13__) \
+    || defined(__AVR_ATtiny13A__)
+    #ifndef TRIO_AVR_PCINT_B
+        #define TRIO_AVR_PCINT_B 0
+    #endif
+#endif
+
 namespace TRIO
 {
     namespace Private
     {
+        //PCINT group registers. Group -1 is for ports without PCINT
+        template< int GROUP >
+        struct PcintGroup
+        {
+            static void Enable(uint8_t mask){ }
+            static void Disable(uint8_t mask){ }
+        };
+
+    #if defined(PCICR)
+        #define TRIO_AVR_PCINT_CTRL PCICR
+    #else
+        #define TRIO_AVR_PCINT_CTRL GIMSK
+    #endif
+        #define TRIO_AVR_MAKE_PCINT_GROUP(GROUP, MASK_REG, ENABLE_BIT) \
+        template<> \
+        struct PcintGroup< GROUP > \
+        { \
+            static void Enable(uint8_t mask){ MASK_REG |= mask; TRIO_AVR_PCINT_CTRL |= (uint8_t)(1 << ENABLE_BIT); } \
+            static void Disable(uint8_t mask){ MASK_REG &= (uint8_t)~mask; } \
+        };
+
+    #if defined(PCMSK0)
+        TRIO_AVR_MAKE_PCINT_GROUP(0, PCMSK0, PCIE0)
+    #elif defined(PCMSK)
+        TRIO_AVR_MAKE_PCINT_GROUP(0, PCMSK, PCIE)
+    #endif
+    #if defined(PCMSK1)
+        TRIO_AVR_MAKE_PCINT_GROUP(1, PCMSK1, PCIE1)
+    #endif
+    #if defined(PCMSK2)
+        TRIO_AVR_MAKE_PCINT_GROUP(2, PCMSK2, PCIE2)
+    #endif
+    #if defined(PCMSK3)
+        TRIO_AVR_MAKE_PCINT_GROUP(3, PCMSK3, PCIE3)
+    #endif
+    #undef TRIO_AVR_MAKE_PCINT_GROUP
+    #undef TRIO_AVR_PCINT_CTRL
+
         struct NativePortBase
         {	
             typedef uint8_t DataT;
             enum{ Width = sizeof(DataT) * CHAR_BITS };                      
+            //No GPIO clock gating, see trio_clock_gating.hpp
+            typedef NullRegister ClockEnableReg;
+            static const uint32_t ClockEnableMask = 0;
+            static const bool HasPinToggle = TRIO_AVR_HAS_PINX_TOGGLE;  //see TRIO_AVR_HAS_PINX_TOGGLE
         };//struct NativePortBase
     	
-        //template paramaters is PORT, DDR and PIN registers from datasheet
-        template<class PORTx, class DDRx, class PINx >
+        //template paramaters is PORT, DDR and PIN registers from datasheet and PCINT group of the port
+        template<class PORTx, class DDRx, class PINx, int PCINT_GROUP = -1 >
     	class PortImplimentation: public NativePortBase
         {            
         public:           
@@ -57,19 +169,33 @@ namespace TRIO
 			static DataT Read(){ return PINx::Value(); }			//Read GPIO input register
             static DataT ReadOutReg(){ return PORTx::Value(); }		//Read GPIO output register
             //static DataT PinRead(){ return PINx::Value(); }
-            static void Set(DataT value){ PORTx::Or(value); }
-    		static void Clear(DataT value){ PORTx::And( (DataT)~value ); }
-            static void ClearAndSet(DataT clearMask, DataT value){ PORTx::AndOr((DataT)~clearMask, value); }
-    		static void Toggle(DataT value){ PORTx::Xor(value); }                        
+            //read-modify-write operations are protected according to TRIO_RMW_POLICY, see trio_atomic.hpp
+            static void Set(DataT value){ RmwPolicy::Or<PORTx>(value); }
+    		static void Clear(DataT value){ RmwPolicy::And<PORTx>( (DataT)~value ); }
+            static void ClearAndSet(DataT clearMask, DataT value){ RmwPolicy::AndOr<PORTx>((DataT)~clearMask, value); }
+        #if TRIO_AVR_HAS_PINX_TOGGLE
+    		static void Toggle(DataT value){ PINx::Set(value); }  //writing 1 to PINx toggles PORTx bit, atomic
+        #else
+    		static void Toggle(DataT value){ RmwPolicy::Xor<PORTx>(value); }
+        #endif
 
             template<DataT value>
-    		static void Set(){ PORTx::Or(value); }
+    		static void Set(){ RmwPolicy::Or<PORTx, value>(); }
     		template<DataT value>
-    		static void Clear(){ PORTx::And((DataT)~value); }
+    		static void Clear(){ RmwPolicy::And<PORTx, (DataT)~value>(); }
             template<DataT clearMask, DataT value>
-    		static void ClearAndSet(){ PORTx::AndOr((DataT)~clearMask, value); }
+    		static void ClearAndSet(){ RmwPolicy::AndOr<PORTx, (DataT)~clearMask, value>(); }
+        #if TRIO_AVR_HAS_PINX_TOGGLE
+            template<DataT value>
+    		static void Toggle(){ PINx::Set(value); }
+        #else
             template<DataT value>
-    		static void Toggle(){ PORTx::Xor(value); }
+    		static void Toggle(){ RmwPolicy::Xor<PORTx, value>(); }
+        #endif
+
+            //Read only pins in MASK. Ports may read single pin faster
+            template<DataT MASK>
+            static DataT Read(){ return (DataT)(Read() & MASK); }
 
             struct Configure
             {   
@@ -100,9 +226,70 @@ namespace TRIO
                 template<DataT MASK>
                 static void DisableAF(){ }  //there is no special bit for AF in AVR
                 template<DataT MASK>
-                static void EnableInterrupt(){  } //Interrupt register is not in GPIO module, so empty
+                static void EnableInterrupt(){ PcintGroup<PCINT_GROUP>::Enable(MASK); }	//Pin change interrupt, see TRIO_AVR_PCINT_x
                 template<DataT MASK>
-                static void DisableInterrupt(){  } //Interrupt register is not in GPIO module, so empty
+                static void DisableInterrupt(){ PcintGroup<PCINT_GROUP>::Disable(MASK); }
+
+                //Same configurations with runtime mask
+                static void OutPushPull_Slow(DataT mask){ OutPushPull_Fast(mask); }
+                static void OutPushPull_Medium(DataT mask){ OutPushPull_Fast(mask); }
+                static void OutPushPull_Fast(DataT mask){ DDRx::Or(mask); }
+                static void OutOpenDrain_Slow(DataT mask){ }
+                static void OutOpenDrain_Medium(DataT mask){ }
+                static void OutOpenDrain_Fast(DataT mask){ }
+
+                static void InFloating(DataT mask){ DDRx::And( (DataT)~mask ); PORTx::And( (DataT)~mask ); }
+                static void InPullUp(DataT mask){ DDRx::And( (DataT)~mask ); PORTx::Or(mask); }
+                static void InPullDown(DataT mask){ InFloating(mask); }
+                static void InAnalog(DataT mask){ InFloating(mask); }
+
+                static void EnableAF(DataT mask){ }
+                static void DisableAF(DataT mask){ }
+                static void EnableInterrupt(DataT mask){ PcintGroup<PCINT_GROUP>::Enable(mask); }
+                static void DisableInterrupt(DataT mask){ PcintGroup<PCINT_GROUP>::Disable(mask); }
+            };
+
+            //Same configurations as in Configure, but with runtime masks.
+            //Changes are collected and applied by Commit() with one read and one write per DDR and PORT
+            //See trio_config_transaction.hpp
+            class ConfigTransaction
+            {
+                StagedRegWrite<DDRx> ddr;
+                StagedRegWrite<PORTx> port;
+                DataT intEnable;	//PCINT mask changes, PCMSKn is not in GPIO module, so it is not a StagedRegWrite
+                DataT intDisable;
+            public:
+                ConfigTransaction(): intEnable(0), intDisable(0){ }
+
+                void OutPushPull_Slow(DataT mask){ OutPushPull_Fast(mask); }
+                void OutPushPull_Medium(DataT mask){ OutPushPull_Fast(mask); }
+                void OutPushPull_Fast(DataT mask){ ddr.Or(mask); }
+                void OutOpenDrain_Slow(DataT mask){ }      //Open Drain is not supported on AVR
+                void OutOpenDrain_Medium(DataT mask){ }    //Open Drain is not supported on AVR
+                void OutOpenDrain_Fast(DataT mask){ }      //Open Drain is not supported on AVR
+
+                void InFloating(DataT mask){ ddr.And( (DataT)~mask ); port.And( (DataT)~mask ); }
+                void InPullUp(DataT mask){ ddr.And( (DataT)~mask ); port.Or(mask); }
+                void InPullDown(DataT mask){ InFloating(mask); } //Pull down is not supported on AVR
+                void InAnalog(DataT mask){ InFloating(mask); }
+
+                void EnableAF(DataT mask){ }   //there is no special bit for AF in AVR
+                void DisableAF(DataT mask){ }  //there is no special bit for AF in AVR
+                void EnableInterrupt(DataT mask){ intEnable |= mask; intDisable &= (DataT)~mask; }	//Pin change interrupt, see TRIO_AVR_PCINT_x
+                void DisableInterrupt(DataT mask){ intDisable |= mask; intEnable &= (DataT)~mask; }
+
+                //Same register order as in Configure, pin change interrupts are enabled after pins are configured
+                void Commit()
+                {
+                    ddr.Commit();
+                    port.Commit();
+                    if( intDisable )
+                        PcintGroup<PCINT_GROUP>::Disable(intDisable);
+                    if( intEnable )
+                        PcintGroup<PCINT_GROUP>::Enable(intEnable);
+                    intEnable = intDisable = 0;
+                }
+                void Cancel(){ ddr.Cancel(); port.Cancel(); intEnable = intDisable = 0; }
             };
 
             //=============Hardware specific API for maximum flexibility======================            
@@ -141,11 +328,49 @@ namespace TRIO
     namespace Private{\
 		PORT_REGS_WRAPPER(PORT_LETTER)\
 	}\
-	struct className: public Private::PortImplimentation<Private::Out ## PORT_LETTER, Private::Dir ## PORT_LETTER, Private::In ## PORT_LETTER>\
+	struct className: public Private::PortImplimentation<Private::Out ## PORT_LETTER, Private::Dir ## PORT_LETTER, Private::In ## PORT_LETTER, TRIO_AVR_PCINT_ ## PORT_LETTER>\
     {\
 		enum{ Id = ID };\
     };
 
+//Ports without PCINT group
+#ifndef TRIO_AVR_PCINT_A
+    #define TRIO_AVR_PCINT_A -1
+#endif
+#ifndef TRIO_AVR_PCINT_B
+    #define TRIO_AVR_PCINT_B -1
+#endif
+#ifndef TRIO_AVR_PCINT_C
+    #define TRIO_AVR_PCINT_C -1
+#endif
+#ifndef TRIO_AVR_PCINT_D
+    #define TRIO_AVR_PCINT_D -1
+#endif
+#ifndef TRIO_AVR_PCINT_E
+    #define TRIO_AVR_PCINT_E -1
+#endif
+#ifndef TRIO_AVR_PCINT_F
+    #define TRIO_AVR_PCINT_F -1
+#endif
+#ifndef TRIO_AVR_PCINT_G
+    #define TRIO_AVR_PCINT_G -1
+#endif
+#ifndef TRIO_AVR_PCINT_H
+    #define TRIO_AVR_PCINT_H -1
+#endif
+#ifndef TRIO_AVR_PCINT_I
+    #define TRIO_AVR_PCINT_I -1
+#endif
+#ifndef TRIO_AVR_PCINT_J
+    #define TRIO_AVR_PCINT_J -1
+#endif
+#ifndef TRIO_AVR_PCINT_K
+    #define TRIO_AVR_PCINT_K -1
+#endif
+#ifndef TRIO_AVR_PCINT_Q
+    #define TRIO_AVR_PCINT_Q -1
+#endif
+
 /*PORTA, PORTB..etc are defined by AVR LibC HW specific headers. see <avr/io.h>*/
 #ifdef PORTA 
     #define TRIO_HAS_PORTA
@@ -0,0 +1,323 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#ifndef TRIO_GPIO_IMPLEMENTATION_HPP_AVRXT_
+#define TRIO_GPIO_IMPLEMENTATION_HPP_AVRXT_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+/*Modern AVR port(tinyAVR 0/1/2, megaAVR 0, AVR Dx/Ex)
+*
+* Output and input use bit addressable virtual port VPORTx(1 cycle IN/OUT/SBI/CBI):
+* Write, Read, ReadOutReg           - VPORTx.OUT, VPORTx.IN
+* compile time single pin Set/Clear - SBI/CBI on VPORTx.OUT(atomic)
+* Toggle                            - writing 1s to VPORTx.IN toggles output(atomic)
+* multi pin Set/Clear/ClearAndSet   - PORTx.OUTSET/OUTCLR stores, no read-modify-write
+* Direction                         - PORTx.DIRSET/DIRCLR
+*
+* Pin configuration lives in PINnCTRL registers(one per pin). If MCU has PINCONFIG/PINCTRLUPD registers(AVR Dx/Ex, tinyAVR 2),
+* multi pin configuration is done with 2-4 stores regardless of count of pins. Otherwise every pin's PINnCTRL is written.
+* Note: PINCONFIG is shared by all ports, so don't configure pins from interrupts while main code configures pins too.*/
+
+//define to know what MCU we are running on
+//#define TRIO_STM8_PORT_
+//#define TRIO_STM32_PORT_
+//#define TRIO_AVR_PORT_
+//#define TRIO_XMEGA_PORT_
+#define TRIO_AVRXT_PORT_
+
+//Multi pin configuration registers
+#if defined(PORTA_PINCTRLUPD) && !defined(TRIO_AVRXT_HAS_PINCONFIG)
+    #define TRIO_AVRXT_HAS_PINCONFIG 1
+#endif
+#ifndef TRIO_AVRXT_HAS_PINCONFIG
+    #define TRIO_AVRXT_HAS_PINCONFIG 0
+#endif
+
+namespace TRIO
+{
+    namespace Private
+    {
+        struct NativePortBase
+        {	
+            typedef uint8_t DataT;
+            enum{ Width = sizeof(DataT) * CHAR_BITS };
+            //No GPIO clock gating, see trio_clock_gating.hpp
+            typedef NullRegister ClockEnableReg;
+            static const uint32_t ClockEnableMask = 0;
+        };//struct NativePortBase	    	
+
+        template< class T >
+    	class PortImplimentation: public NativePortBase
+        {
+			//Helper classes to access GPIO registers nice and easy
+			IO_REG_WRAPPER(T::GetPORT_tRef().DIRSET, DIRSET, DataT);
+			IO_REG_WRAPPER(T::GetPORT_tRef().DIRCLR, DIRCLR, DataT);
+			IO_REG_WRAPPER(T::GetPORT_tRef().OUTSET, OUTSET, DataT);
+			IO_REG_WRAPPER(T::GetPORT_tRef().OUTCLR, OUTCLR, DataT);
+			IO_REG_WRAPPER(T::GetVPORT_tRef().OUT, VOUT, DataT);
+			IO_REG_WRAPPER(T::GetVPORT_tRef().IN, VIN, DataT);
+
+			static volatile uint8_t *PinCtrl(){ return &T::GetPORT_tRef().PIN0CTRL; }
+
+			//Compile time Set/Clear. Single pin - SBI/CBI on virtual port, otherwise OUTSET/OUTCLR
+			template< bool SINGLE_BIT, int DONTCARE=0 >
+			struct SetClearOp
+			{
+				static void Set(DataT value){ OUTSET::Set(value); }
+				static void Clear(DataT value){ OUTCLR::Set(value); }
+			};
+			template< int DONTCARE >
+			struct SetClearOp<true, DONTCARE>
+			{
+				static void Set(DataT value){ VOUT::Or(value); }
+				static void Clear(DataT value){ VOUT::And( (DataT)~value ); }
+			};
+			template< DataT MASK >
+			struct IsSingleBit{ static const bool value = MASK != 0 && (MASK & (MASK - 1)) == 0; };
+
+			//PINnCTRL = value for all pins in MASK
+			template< DataT MASK >
+			static void WritePinCtrl(uint8_t value)
+			{
+			#if TRIO_AVRXT_HAS_PINCONFIG
+				if( !IsSingleBit<MASK>::value )
+				{
+					T::GetPORT_tRef().PINCONFIG = value;
+					T::GetPORT_tRef().PINCTRLUPD = MASK;
+					return;
+				}
+			#endif
+				for( uint8_t pin = 0; pin < Width; ++pin )
+					if( MASK & (1U << pin) )
+						PinCtrl()[pin] = value;
+			}
+			//Clear then set bits of PINnCTRL for all pins in MASK
+			template< DataT MASK >
+			static void ModifyPinCtrl(uint8_t clearBits, uint8_t setBits)
+			{
+			#if TRIO_AVRXT_HAS_PINCONFIG
+				if( !IsSingleBit<MASK>::value )
+				{
+					if( clearBits )
+					{
+						T::GetPORT_tRef().PINCONFIG = clearBits;
+						T::GetPORT_tRef().PINCTRLCLR = MASK;
+					}
+					if( setBits )
+					{
+						T::GetPORT_tRef().PINCONFIG = setBits;
+						T::GetPORT_tRef().PINCTRLSET = MASK;
+					}
+					return;
+				}
+			#endif
+				for( uint8_t pin = 0; pin < Width; ++pin )
+					if( MASK & (1U << pin) )
+						PinCtrl()[pin] = (uint8_t)( (PinCtrl()[pin] & ~clearBits) | setBits );
+			}
+			//Same with runtime mask
+			static void WritePinCtrl(DataT mask, uint8_t value)
+			{
+			#if TRIO_AVRXT_HAS_PINCONFIG
+				if( mask & (mask - 1) )	//more than one pin
+				{
+					T::GetPORT_tRef().PINCONFIG = value;
+					T::GetPORT_tRef().PINCTRLUPD = mask;
+					return;
+				}
+			#endif
+				for( uint8_t pin = 0; pin < Width; ++pin )
+					if( mask & (1U << pin) )
+						PinCtrl()[pin] = value;
+			}
+			static void ModifyPinCtrl(DataT mask, uint8_t clearBits, uint8_t setBits)
+			{
+			#if TRIO_AVRXT_HAS_PINCONFIG
+				if( mask & (mask - 1) )	//more than one pin
+				{
+					if( clearBits )
+					{
+						T::GetPORT_tRef().PINCONFIG = clearBits;
+						T::GetPORT_tRef().PINCTRLCLR = mask;
+					}
+					if( setBits )
+					{
+						T::GetPORT_tRef().PINCONFIG = setBits;
+						T::GetPORT_tRef().PINCTRLSET = mask;
+					}
+					return;
+				}
+			#endif
+				for( uint8_t pin = 0; pin < Width; ++pin )
+					if( mask & (1U << pin) )
+						PinCtrl()[pin] = (uint8_t)( (PinCtrl()[pin] & ~clearBits) | setBits );
+			}
+        public:           
+            //=============Generic API. Everybody should implement and respect it==============
+    		static void Write(DataT value){ VOUT::Set(value); }	//Write to GPIO output register
+			static DataT Read(){ return VIN::Value(); }			//Read GPIO input register
+            static DataT ReadOutReg(){ return VOUT::Value(); }	//Read GPIO output register
+            static void Set(DataT value){ OUTSET::Set(value); }
+    		static void Clear(DataT value){ OUTCLR::Set(value); }
+            static void ClearAndSet(DataT clearMask, DataT value){ OUTCLR::Set( (DataT)(clearMask & ~value) ); OUTSET::Set(value); }
+    		static void Toggle(DataT value){ VIN::Set(value); }	//writing 1 to VPORTx.IN toggles output
+
+            template<DataT value>
+    		static void Set(){ SetClearOp< IsSingleBit<value>::value >::Set(value); }
+    		template<DataT value>
+    		static void Clear(){ SetClearOp< IsSingleBit<value>::value >::Clear(value); }
+            template<DataT clearMask, DataT value>
+    		static void ClearAndSet(){ ClearAndSet(clearMask, value); }
+            template<DataT value>
+    		static void Toggle(){ VIN::Set(value); }
+
+            //Read only pins in MASK. Ports may read single pin faster
+            template<DataT MASK>
+            static DataT Read(){ return (DataT)(Read() & MASK); }
+
+            struct Configure
+            {   
+                //there is no speed setting in AVR
+                template<DataT MASK>
+                static void OutPushPull_Slow(){ OutPushPull_Fast<MASK>(); }
+                template<DataT MASK>
+                static void OutPushPull_Medium(){ OutPushPull_Fast<MASK>(); }
+                template<DataT MASK>
+                static void OutPushPull_Fast(){ ModifyPinCtrl<MASK>( PORT_PULLUPEN_bm, 0 ); DIRSET::Set(MASK); }
+                template<DataT MASK>
+                static void OutOpenDrain_Slow(){ }      //Open Drain is not supported on AVR
+                template<DataT MASK>
+                static void OutOpenDrain_Medium(){ }    //Open Drain is not supported on AVR
+                template<DataT MASK>
+                static void OutOpenDrain_Fast(){ }      //Open Drain is not supported on AVR
+            
+                template<DataT MASK>
+                static void InFloating(){ DIRCLR::Set(MASK); WritePinCtrl<MASK>( PORT_ISC_INTDISABLE_gc ); }
+                template<DataT MASK>
+                static void InPullUp(){ DIRCLR::Set(MASK); WritePinCtrl<MASK>( PORT_PULLUPEN_bm | PORT_ISC_INTDISABLE_gc ); }
+                template<DataT MASK>
+                static void InPullDown(){ InFloating<MASK>(); } //Pull down is not supported on AVR
+                //Digital input buffer is disabled
+                template<DataT MASK>
+                static void InAnalog(){ DIRCLR::Set(MASK); WritePinCtrl<MASK>( PORT_ISC_INPUT_DISABLE_gc ); }
+
+                template<DataT MASK>
+                static void EnableAF(){ }   //peripherals override pins, there is no special bit for AF in AVR
+                template<DataT MASK>
+                static void DisableAF(){ }  //peripherals override pins, there is no special bit for AF in AVR
+                //Both edges interrupt. Please apply this to INPUT pins only!
+                template<DataT MASK>
+                static void EnableInterrupt(){ ModifyPinCtrl<MASK>( PORT_ISC_gm, PORT_ISC_BOTHEDGES_gc ); }
+                template<DataT MASK>
+                static void DisableInterrupt(){ ModifyPinCtrl<MASK>( PORT_ISC_gm, PORT_ISC_INTDISABLE_gc ); }
+
+                //Same configurations with runtime mask
+                static void OutPushPull_Slow(DataT mask){ OutPushPull_Fast(mask); }
+                static void OutPushPull_Medium(DataT mask){ OutPushPull_Fast(mask); }
+                static void OutPushPull_Fast(DataT mask){ ModifyPinCtrl( mask, PORT_PULLUPEN_bm, 0 ); DIRSET::Set(mask); }
+                static void OutOpenDrain_Slow(DataT mask){ }
+                static void OutOpenDrain_Medium(DataT mask){ }
+                static void OutOpenDrain_Fast(DataT mask){ }
+
+                static void InFloating(DataT mask){ DIRCLR::Set(mask); WritePinCtrl( mask, PORT_ISC_INTDISABLE_gc ); }
+                static void InPullUp(DataT mask){ DIRCLR::Set(mask); WritePinCtrl( mask, PORT_PULLUPEN_bm | PORT_ISC_INTDISABLE_gc ); }
+                static void InPullDown(DataT mask){ InFloating(mask); }
+                static void InAnalog(DataT mask){ DIRCLR::Set(mask); WritePinCtrl( mask, PORT_ISC_INPUT_DISABLE_gc ); }
+
+                static void EnableAF(DataT mask){ }
+                static void DisableAF(DataT mask){ }
+                static void EnableInterrupt(DataT mask){ ModifyPinCtrl( mask, PORT_ISC_gm, PORT_ISC_BOTHEDGES_gc ); }
+                static void DisableInterrupt(DataT mask){ ModifyPinCtrl( mask, PORT_ISC_gm, PORT_ISC_INTDISABLE_gc ); }
+            };
+
+            //=============Hardware specific API for maximum flexibility======================            
+            //TPin will expose this API to users as Pxn::HWSpecificAPI::HWSpecific_method();
+            //Some operations may need MASK to work, TPin will provide it.
+            template< DataT MASK=0 >
+            struct HWSpecificAPI
+            {
+				//Return reference to port registers for super low level hacks )
+				static PORT_t &GetGPIORegsReference(){ return T::GetPORT_tRef(); }
+				static VPORT_t &GetVPORTRegsReference(){ return T::GetVPORT_tRef(); }
+
+				//Input sense configuration. Apply this AFTER configuring pin AS INPUT
+				static void SetISC_BOTHEDGES(){ ModifyPinCtrl<MASK>( PORT_ISC_gm, PORT_ISC_BOTHEDGES_gc ); }
+				static void SetISC_RISING(){ ModifyPinCtrl<MASK>( PORT_ISC_gm, PORT_ISC_RISING_gc ); }
+				static void SetISC_FALLING(){ ModifyPinCtrl<MASK>( PORT_ISC_gm, PORT_ISC_FALLING_gc ); }
+				static void SetISC_LEVEL(){ ModifyPinCtrl<MASK>( PORT_ISC_gm, PORT_ISC_LEVEL_gc ); }
+				//Hardware inversion of input and output(INVEN bit)
+				static void EnableInversion(){ ModifyPinCtrl<MASK>( 0, PORT_INVEN_bm ); }
+				static void DisableInversion(){ ModifyPinCtrl<MASK>( PORT_INVEN_bm, 0 ); }
+				//Clear interrupt flags of pins
+				static void ClearInterruptFlags(){ T::GetVPORT_tRef().INTFLAGS = MASK; }
+            };            
+    	};//PortImplimentation
+    }//namespace Private
+
+//see ioregwrapper.hpp for IO_REG_WRAPPER macro
+#define MAKE_PORT(PORT_LETTER, className, ID) \
+class className :public Private::PortImplimentation<className>{\
+	static PORT_t &GetPORT_tRef(){ return PORT ## PORT_LETTER; }\
+	static VPORT_t &GetVPORT_tRef(){ return VPORT ## PORT_LETTER; }\
+	friend class Private::PortImplimentation<className>;\
+	public:\
+	enum{Id = ID};\
+};
+
+/*PORTA, VPORTA...etc are defined by AVR LibC HW specific headers. see <avr/io.h>*/
+#ifdef PORTA
+    #define TRIO_HAS_PORTA
+    MAKE_PORT(A, Porta, 'A')
+#endif
+#ifdef PORTB
+    #define TRIO_HAS_PORTB
+    MAKE_PORT(B, Portb, 'B')
+#endif
+#ifdef PORTC
+    #define TRIO_HAS_PORTC
+    MAKE_PORT(C, Portc, 'C')
+#endif
+#ifdef PORTD
+    #define TRIO_HAS_PORTD
+    MAKE_PORT(D, Portd, 'D')
+#endif
+#ifdef PORTE
+    #define TRIO_HAS_PORTE
+    MAKE_PORT(E, Porte, 'E')
+#endif
+#ifdef PORTF
+    #define TRIO_HAS_PORTF
+    MAKE_PORT(F, Portf, 'F')
+#endif
+#ifdef PORTG
+    #define TRIO_HAS_PORTG
+    MAKE_PORT(G, Portg, 'G')
+#endif
+}//namespace TRIO
+#endif /*TRIO_GPIO_IMPLEMENTATION_HPP_AVRXT_*/
@@ -0,0 +1,393 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#ifndef TRIO_GPIO_IMPLEMENTATION_HPP_BCM283X_
+#define TRIO_GPIO_IMPLEMENTATION_HPP_BCM283X_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+/*Memory mapped GPIO of Broadcom BCM283x/BCM2711 SoC(Raspberry Pi) from Linux userspace.
+* GPIO register block is mapped once(/dev/gpiomem by default) and then every port operation is plain
+* volatile load/store. No syscalls at all after mapping.
+*
+* Map registers before first use of any port:
+* if( !TRIO::GpioMem::Map() ) perror("gpiomem");
+*
+* Map(path, offset) can map any file, so regular 4K file can be used for tests and benchmarks.
+* Attach(pointer) uses any memory as GPIO registers.
+*
+* Porta is GPIO0..GPIO31, Portb is GPIO32..GPIO53
+* Set/Clear/ClearAndSet use GPSET/GPCLR registers, so they are atomic.
+* There is no output register readback in BCM283x, ReadOutReg() returns pin levels(GPLEV) same as Read().
+*
+* Pulls: BCM2711(Raspberry Pi 4) has GPIO_PUP_PDN_CNTRL registers, define TRIO_BCM2711 to use them.
+* Otherwise legacy GPPUD/GPPUDCLK sequence is used.
+*
+* Function select registers are changed by read-modify-write, protected according to TRIO_RMW_POLICY(see trio_atomic.hpp)
+* Note: there is no interrupts in userspace, so TRIO_RMW_IRQLOCK can't protect from other processes. */
+
+//define to know on what MCU we are running
+//#define TRIO_STM8_PORT_
+//#define TRIO_STM32_PORT_
+//#define TRIO_AVR_PORT_
+//#define TRIO_XMEGA_PORT_
+#define TRIO_BCM283X_PORT_
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#ifndef TRIO_GPIOMEM_DEVICE
+    #define TRIO_GPIOMEM_DEVICE "/dev/gpiomem"
+#endif
+
+namespace TRIO
+{
+    namespace Private
+    {
+        //Static storage for mapping. Template is used to keep it header only
+        template< int DUMMY=0 >
+        struct GpioMemStorage
+        {
+            static volatile uint32_t *Regs;
+            static void *Mapping;
+            static int LastError;
+        };
+        template< int DUMMY > volatile uint32_t *GpioMemStorage<DUMMY>::Regs = 0;
+        template< int DUMMY > void *GpioMemStorage<DUMMY>::Mapping = 0;
+        template< int DUMMY > int GpioMemStorage<DUMMY>::LastError = 0;
+    }//namespace Private
+
+    /*GPIO register block mapping*/
+    class GpioMem
+    {
+        typedef Private::GpioMemStorage<> Storage;
+    public:
+        static const size_t MapSize = 4096;     //GPIO block is smaller than one page
+
+        //Map register block from file. offset - physical address of GPIO block if /dev/mem is used
+        static bool Map(const char *path = TRIO_GPIOMEM_DEVICE, off_t offset = 0)
+        {
+            if( Storage::Mapping )
+                return true;        //already mapped
+            const int fd = ::open( path, O_RDWR | O_SYNC | O_CLOEXEC );
+            if( fd < 0 )
+            {
+                Storage::LastError = errno;
+                return false;
+            }
+            void *mapping = ::mmap( 0, MapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, offset );
+            Storage::LastError = (mapping == MAP_FAILED) ? errno : 0;
+            ::close( fd );          //mapping stays valid after close
+            if( mapping == MAP_FAILED )
+                return false;
+            Storage::Mapping = mapping;
+            Storage::Regs = static_cast<volatile uint32_t *>( mapping );
+            return true;
+        }
+        //Use any memory as GPIO registers. Memory should be at least MapSize bytes
+        static void Attach(volatile uint32_t *regs){ Unmap(); Storage::Regs = regs; }
+        static void Unmap()
+        {
+            if( Storage::Mapping )
+                ::munmap( Storage::Mapping, MapSize );
+            Storage::Mapping = 0;
+            Storage::Regs = 0;
+        }
+        static bool IsMapped(){ return Storage::Regs != 0; }
+        static int LastError(){ return Storage::LastError; }
+        static volatile uint32_t *Regs(){ return Storage::Regs; }
+    };
+
+    namespace Private
+    {
+        struct NativePortBase
+        {
+            typedef uint32_t DataT;
+            enum{ Width = sizeof(DataT) * CHAR_BITS };
+            //No GPIO clock gating, see trio_clock_gating.hpp
+            typedef NullRegister ClockEnableReg;
+            static const uint32_t ClockEnableMask = 0;
+
+            //GPFSEL function values
+            enum{ FselInput = 0, FselOutput = 1, FselAlt0 = 4 };
+            //Register word offsets in GPIO block
+            enum
+            {
+                GPFSEL0 = 0x00 / 4,
+                GPSET0 = 0x1C / 4,
+                GPCLR0 = 0x28 / 4,
+                GPLEV0 = 0x34 / 4,
+                GPPUD = 0x94 / 4,
+                GPPUDCLK0 = 0x98 / 4,
+                GPIO_PUP_PDN_CNTRL_REG0 = 0xE4 / 4
+            };
+            //pull values. BCM2711 and legacy GPPUD have different encoding
+        #if defined(TRIO_BCM2711)
+            enum{ PullNone = 0, PullUp = 1, PullDown = 2 };
+        #else
+            enum{ PullNone = 0, PullDown = 1, PullUp = 2 };
+        #endif
+        };//struct NativePortBase
+
+        /*Spread port pin mask to one GPFSEL register(3 bits per pin, 10 pins per register).
+        * GPIO number is BANK*32 + bit. Result has 1 at the lowest bit of each pin field*/
+        template< uint32_t MASK, int BANK, int REG, int BIT = 31 >
+        struct FselSpread
+        {
+            static const int Gpio = BANK * 32 + BIT;
+            static const uint32_t value = ( ((MASK >> BIT) & 1) && (Gpio / 10 == REG) ? (1UL << (Gpio % 10) * 3) : 0 )
+                                          | FselSpread<MASK, BANK, REG, BIT - 1>::value;
+        };
+        template< uint32_t MASK, int BANK, int REG >
+        struct FselSpread< MASK, BANK, REG, -1 >{ static const uint32_t value = 0; };
+
+        /*Spread port pin mask to one GPIO_PUP_PDN_CNTRL register(2 bits per pin, 16 pins per register)*/
+        template< uint32_t MASK, int BANK, int REG, int BIT = 31 >
+        struct PullSpread
+        {
+            static const int Gpio = BANK * 32 + BIT;
+            static const uint32_t value = ( ((MASK >> BIT) & 1) && (Gpio / 16 == REG) ? (1UL << (Gpio % 16) * 2) : 0 )
+                                          | PullSpread<MASK, BANK, REG, BIT - 1>::value;
+        };
+        template< uint32_t MASK, int BANK, int REG >
+        struct PullSpread< MASK, BANK, REG, -1 >{ static const uint32_t value = 0; };
+
+        template< class T >
+    	class PortImplimentation: public NativePortBase
+        {
+            static const int BANK = T::Bank;
+
+            IO_REG_WRAPPER(GpioMem::Regs()[GPSET0 + BANK], GPSET, uint32_t);
+            IO_REG_WRAPPER(GpioMem::Regs()[GPCLR0 + BANK], GPCLR, uint32_t);
+            IO_REG_WRAPPER(GpioMem::Regs()[GPLEV0 + BANK], GPLEV, uint32_t);
+
+            template< int N >
+            struct GPFSEL{ IO_REG_WRAPPER(GpioMem::Regs()[GPFSEL0 + N], Reg, uint32_t); };
+            template< int N >
+            struct PUPPDN{ IO_REG_WRAPPER(GpioMem::Regs()[GPIO_PUP_PDN_CNTRL_REG0 + N], Reg, uint32_t); };
+
+            //One masked write of GPFSEL register N if any pin of MASK is in it
+            template< DataT MASK, uint32_t FUNC, int N >
+            static void WriteFselReg()
+            {
+                const uint32_t spread = FselSpread<MASK, BANK, N>::value;
+                if( spread )
+                    RmwPolicy::AndOr< typename GPFSEL<N>::Reg, (uint32_t)~(spread * 7), spread * FUNC >();
+            }
+            //Write function for all pins in MASK. Only GPFSEL registers with pins from MASK are touched
+            template< DataT MASK, uint32_t FUNC >
+            static void WriteFsel()
+            {
+                WriteFselReg<MASK, FUNC, 0>();
+                WriteFselReg<MASK, FUNC, 1>();
+                WriteFselReg<MASK, FUNC, 2>();
+                WriteFselReg<MASK, FUNC, 3>();
+                WriteFselReg<MASK, FUNC, 4>();
+                WriteFselReg<MASK, FUNC, 5>();
+            }
+            //Same with runtime mask. Loops are unrolled by compiler: N and BANK are constants
+            template< int N >
+            static void WriteFselReg(DataT mask, uint32_t func)
+            {
+                uint32_t spread = 0;
+                for( int gpio = N * 10; gpio < N * 10 + 10; ++gpio )
+                    if( gpio / 32 == BANK && ((mask >> (gpio % 32)) & 1) )
+                        spread |= 1UL << (gpio % 10) * 3;
+                if( spread )
+                    RmwPolicy::AndOr< typename GPFSEL<N>::Reg >( ~(spread * 7), spread * func );
+            }
+            static void WriteFsel(DataT mask, uint32_t func)
+            {
+                WriteFselReg<0>( mask, func );
+                WriteFselReg<1>( mask, func );
+                WriteFselReg<2>( mask, func );
+                WriteFselReg<3>( mask, func );
+                WriteFselReg<4>( mask, func );
+                WriteFselReg<5>( mask, func );
+            }
+
+        #if defined(TRIO_BCM2711)
+            template< DataT MASK, uint32_t PULL, int N >
+            static void WritePullReg()
+            {
+                const uint32_t spread = PullSpread<MASK, BANK, N>::value;
+                if( spread )
+                    RmwPolicy::AndOr< typename PUPPDN<N>::Reg, (uint32_t)~(spread * 3), spread * PULL >();
+            }
+            template< DataT MASK, uint32_t PULL >
+            static void WritePull()
+            {
+                WritePullReg<MASK, PULL, 0>();
+                WritePullReg<MASK, PULL, 1>();
+                WritePullReg<MASK, PULL, 2>();
+                WritePullReg<MASK, PULL, 3>();
+            }
+            template< int N >
+            static void WritePullReg(DataT mask, uint32_t pull)
+            {
+                uint32_t spread = 0;
+                for( int gpio = N * 16; gpio < N * 16 + 16; ++gpio )
+                    if( gpio / 32 == BANK && ((mask >> (gpio % 32)) & 1) )
+                        spread |= 1UL << (gpio % 16) * 2;
+                if( spread )
+                    RmwPolicy::AndOr< typename PUPPDN<N>::Reg >( ~(spread * 3), spread * pull );
+            }
+            static void WritePull(DataT mask, uint32_t pull)
+            {
+                WritePullReg<0>( mask, pull );
+                WritePullReg<1>( mask, pull );
+                WritePullReg<2>( mask, pull );
+                WritePullReg<3>( mask, pull );
+            }
+        #else
+            //Datasheet asks for 150 cycles of setup and hold time
+            static void PullDelay(){ for( volatile int i = 0; i < 150; ++i ){ } }
+            template< DataT MASK, uint32_t PULL >
+            static void WritePull(){ WritePull( MASK, PULL ); }
+            static void WritePull(DataT mask, uint32_t pull)
+            {
+                volatile uint32_t *regs = GpioMem::Regs();
+                regs[GPPUD] = pull;
+                PullDelay();
+                regs[GPPUDCLK0 + BANK] = mask;
+                PullDelay();
+                regs[GPPUD] = 0;
+                regs[GPPUDCLK0 + BANK] = 0;
+            }
+        #endif
+        public:
+            //=============Generic API. Everybody should implement and respect it==============
+    		static void Write(DataT value){ GPCLR::Set( ~value ); GPSET::Set( value ); }	//Write to GPIO output register
+            static DataT Read(){ return GPLEV::Value(); }			//Read GPIO input register
+			static DataT ReadOutReg(){ return GPLEV::Value(); }	//No output register readback, pin levels are returned
+            static void Set(DataT value){ GPSET::Set(value); }
+    		static void Clear(DataT value){ GPCLR::Set(value); }
+            static void ClearAndSet(DataT clearMask, DataT value){ GPCLR::Set( clearMask & ~value ); GPSET::Set( value ); }
+    		static void Toggle(DataT value)
+            {
+                const DataT level = GPLEV::Value();
+                GPCLR::Set( level & value );
+                GPSET::Set( ~level & value );
+            }
+
+            template<DataT value>
+    		static void Set(){ GPSET::Set(value); }
+    		template<DataT value>
+    		static void Clear(){ GPCLR::Set(value); }
+            template<DataT clearMask, DataT value>
+    		static void ClearAndSet(){ GPCLR::Set( clearMask & ~value ); GPSET::Set( value ); }
+            template<DataT value>
+    		static void Toggle(){ Toggle(value); }
+
+            //Read only pins in MASK. Ports may read single pin faster
+            template<DataT MASK>
+            static DataT Read(){ return (DataT)(Read() & MASK); }
+
+            struct Configure
+            {
+                //there is no speed setting in BCM283x GPIO
+                template<DataT MASK>
+                static void OutPushPull_Slow(){ OutPushPull_Fast<MASK>(); }
+                template<DataT MASK>
+                static void OutPushPull_Medium(){ OutPushPull_Fast<MASK>(); }
+                template<DataT MASK>
+                static void OutPushPull_Fast(){ WriteFsel<MASK, FselOutput>(); }
+                template<DataT MASK>
+                static void OutOpenDrain_Slow(){ }      //Open Drain is not supported by BCM283x
+                template<DataT MASK>
+                static void OutOpenDrain_Medium(){ }    //Open Drain is not supported by BCM283x
+                template<DataT MASK>
+                static void OutOpenDrain_Fast(){ }      //Open Drain is not supported by BCM283x
+
+                template<DataT MASK>
+                static void InFloating(){ WriteFsel<MASK, FselInput>(); WritePull<MASK, PullNone>(); }
+                template<DataT MASK>
+                static void InPullUp(){ WriteFsel<MASK, FselInput>(); WritePull<MASK, PullUp>(); }
+                template<DataT MASK>
+                static void InPullDown(){ WriteFsel<MASK, FselInput>(); WritePull<MASK, PullDown>(); }
+                template<DataT MASK>
+                static void InAnalog(){ InFloating<MASK>(); }   //no analog in BCM283x GPIO
+
+                //ALT0 function. Use HWSpecificAPI::SetFunction for other functions
+                template<DataT MASK>
+                static void EnableAF(){ WriteFsel<MASK, FselAlt0>(); }
+                template<DataT MASK>
+                static void DisableAF(){ WriteFsel<MASK, FselInput>(); }
+                template<DataT MASK>
+                static void EnableInterrupt(){  } //GPIO interrupts are handled by kernel
+                template<DataT MASK>
+                static void DisableInterrupt(){  } //GPIO interrupts are handled by kernel
+
+                //Same configurations with runtime mask
+                static void OutPushPull_Slow(DataT mask){ OutPushPull_Fast(mask); }
+                static void OutPushPull_Medium(DataT mask){ OutPushPull_Fast(mask); }
+                static void OutPushPull_Fast(DataT mask){ WriteFsel( mask, FselOutput ); }
+                static void OutOpenDrain_Slow(DataT mask){ }
+                static void OutOpenDrain_Medium(DataT mask){ }
+                static void OutOpenDrain_Fast(DataT mask){ }
+
+                static void InFloating(DataT mask){ WriteFsel( mask, FselInput ); WritePull( mask, PullNone ); }
+                static void InPullUp(DataT mask){ WriteFsel( mask, FselInput ); WritePull( mask, PullUp ); }
+                static void InPullDown(DataT mask){ WriteFsel( mask, FselInput ); WritePull( mask, PullDown ); }
+                static void InAnalog(DataT mask){ InFloating(mask); }
+
+                static void EnableAF(DataT mask){ WriteFsel( mask, FselAlt0 ); }
+                static void DisableAF(DataT mask){ WriteFsel( mask, FselInput ); }
+                static void EnableInterrupt(DataT mask){ }
+                static void DisableInterrupt(DataT mask){ }
+            };
+
+            //=============Hardware specific API for maximum flexibility======================
+            //TPin will expose this API to users as Pxn::HWSpecificAPI::HWSpecific_method();
+            //Some operations may need MASK to work, TPin will provide it.
+            template< DataT MASK=0 >
+            struct HWSpecificAPI
+            {
+                //Raw GPFSEL value(0..7) for pins in MASK. See BCM2835 datasheet for ALTn encoding
+                template< uint32_t FUNC >
+                static void SetFunction(){ WriteFsel<MASK, FUNC>(); }
+            };
+    	};//PortImplimentation
+    }//namespace Private
+
+#define MAKE_PORT(className, ID, BANK) \
+        class className :public Private::PortImplimentation<className>{\
+            friend class Private::PortImplimentation<className>;\
+            public:\
+            enum{Id = ID, Bank = BANK};\
+        };
+
+	#define TRIO_HAS_PORTA
+    MAKE_PORT(Porta, 'A', 0)    //GPIO0..GPIO31
+	#define TRIO_HAS_PORTB
+    MAKE_PORT(Portb, 'B', 1)    //GPIO32..GPIO53
+}//namespace TRIO
+#endif /*TRIO_GPIO_IMPLEMENTATION_HPP_BCM283X_*/
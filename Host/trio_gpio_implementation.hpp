@@ -0,0 +1,276 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#ifndef TRIO_GPIO_IMPLEMENTATION_HPP_HOST_
+#define TRIO_GPIO_IMPLEMENTATION_HPP_HOST_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+/*Host(PC) port. GPIO registers are just variables in RAM.
+* Use it to run and test code built on trio without hardware, including multithreaded stress tests
+* of TRIO_RMW_POLICY (see trio_atomic.hpp). Needs C++11 because registers are std::atomic.
+*
+* Every register access is atomic by itself, but read-modify-write is made of separate load and store
+* exactly like on MCU. So without TRIO_RMW_LOCKFREE concurrent writes from different threads can be lost.
+* Note: TRIO_RMW_IRQLOCK does nothing on host, threads are not interrupts.
+*
+* Port width is 16 bits by default, define TRIO_HOST_PORT_WIDTH to 8, 16 or 32 to change it.
+* Input register is driven by test code, see HWSpecificAPI::DriveInputs() */
+
+//define to know on what MCU we are running
+//#define TRIO_STM8_PORT_
+//#define TRIO_STM32_PORT_
+//#define TRIO_AVR_PORT_
+//#define TRIO_XMEGA_PORT_
+#define TRIO_HOST_PORT_
+
+#include <atomic>
+
+#ifndef TRIO_HOST_PORT_WIDTH
+    #define TRIO_HOST_PORT_WIDTH 16
+#endif
+
+//same as IO_REG_WRAPPER but for std::atomic registers. GetAtomic() is used by TRIO_RMW_LOCKFREE policy
+#define HOST_REG_WRAPPER(REG_NAME, CLASS_NAME, DATA_TYPE) \
+	struct CLASS_NAME\
+	{\
+		typedef DATA_TYPE RegDataT;\
+        static std::atomic<RegDataT> &GetAtomic(){ return REG_NAME; }\
+		static RegDataT Value(){return REG_NAME.load();}\
+		static void Set(RegDataT value){REG_NAME.store(value);}\
+		static void Or(RegDataT value){REG_NAME.store(REG_NAME.load() | value);}\
+		static void And(RegDataT value){REG_NAME.store(REG_NAME.load() & value);}\
+		static void Xor(RegDataT value){REG_NAME.store(REG_NAME.load() ^ value);}\
+		static void AndOr(RegDataT andMask, RegDataT orMask){REG_NAME.store((REG_NAME.load() & andMask) | orMask);}\
+	}
+
+namespace TRIO
+{
+    namespace Private
+    {
+        struct NativePortBase
+        {
+        #if TRIO_HOST_PORT_WIDTH == 8
+            typedef uint8_t DataT;
+        #elif TRIO_HOST_PORT_WIDTH == 16
+            typedef uint16_t DataT;
+        #elif TRIO_HOST_PORT_WIDTH == 32
+            typedef uint32_t DataT;
+        #else
+            #error "TRIO_HOST_PORT_WIDTH should be 8, 16 or 32"
+        #endif
+            enum{ Width = sizeof(DataT) * CHAR_BITS };
+            //No GPIO clock gating, see trio_clock_gating.hpp
+            typedef NullRegister ClockEnableReg;
+            static const uint32_t ClockEnableMask = 0;
+        };//struct NativePortBase
+
+        //Port registers. One bit per pin in each register
+        struct HostGpioRegs
+        {
+            typedef NativePortBase::DataT DataT;
+            std::atomic<DataT> OUT;         //output data
+            std::atomic<DataT> IN;          //input data, driven by test code
+            std::atomic<DataT> DIR;         //1 - output
+            std::atomic<DataT> OPENDRAIN;   //1 - open drain output
+            std::atomic<DataT> SPEED;       //1 - fast output
+            std::atomic<DataT> PULLUP;
+            std::atomic<DataT> PULLDOWN;
+            std::atomic<DataT> ANALOG;
+            std::atomic<DataT> AF;          //1 - pin is used by alternate function
+            std::atomic<DataT> IRQ;         //1 - interrupt enabled
+        };
+
+        //Static storage for port registers. ID is port Id
+        template< int ID >
+        struct HostGpioStorage{ static HostGpioRegs Regs; };
+
+        template< int ID >
+        HostGpioRegs HostGpioStorage<ID>::Regs;
+
+        template< class T >
+    	class PortImplimentation: public NativePortBase
+        {
+            //Helper classes to access GPIO registers nice and easy
+            HOST_REG_WRAPPER(T::GetPortStuct().OUT,       OUT,        DataT);
+            HOST_REG_WRAPPER(T::GetPortStuct().IN,        IN,         DataT);
+            HOST_REG_WRAPPER(T::GetPortStuct().DIR,       DIR,        DataT);
+            HOST_REG_WRAPPER(T::GetPortStuct().OPENDRAIN, OPENDRAIN,  DataT);
+            HOST_REG_WRAPPER(T::GetPortStuct().SPEED,     SPEED,      DataT);
+            HOST_REG_WRAPPER(T::GetPortStuct().PULLUP,    PULLUP,     DataT);
+            HOST_REG_WRAPPER(T::GetPortStuct().PULLDOWN,  PULLDOWN,   DataT);
+            HOST_REG_WRAPPER(T::GetPortStuct().ANALOG,    ANALOG,     DataT);
+            HOST_REG_WRAPPER(T::GetPortStuct().AF,        AF,         DataT);
+            HOST_REG_WRAPPER(T::GetPortStuct().IRQ,       IRQ,        DataT);
+
+            //Output pin: set DIR, OPENDRAIN and SPEED bits, clear input only bits
+            template< DataT MASK, bool OPEN_DRAIN, bool FAST >
+            static void ConfigureOut()
+            {
+                RmwPolicy::Or<DIR, MASK>();
+                RmwPolicy::AndOr<OPENDRAIN, (DataT)~MASK, OPEN_DRAIN ? MASK : 0>();
+                RmwPolicy::AndOr<SPEED, (DataT)~MASK, FAST ? MASK : 0>();
+                RmwPolicy::And<ANALOG, (DataT)~MASK>();
+            }
+            //Input pin: clear DIR, set pull bits
+            template< DataT MASK, bool PULL_UP, bool PULL_DOWN, bool IS_ANALOG >
+            static void ConfigureIn()
+            {
+                RmwPolicy::And<DIR, (DataT)~MASK>();
+                RmwPolicy::AndOr<PULLUP, (DataT)~MASK, PULL_UP ? MASK : 0>();
+                RmwPolicy::AndOr<PULLDOWN, (DataT)~MASK, PULL_DOWN ? MASK : 0>();
+                RmwPolicy::AndOr<ANALOG, (DataT)~MASK, IS_ANALOG ? MASK : 0>();
+            }
+            //Same with runtime mask
+            static void ConfigureOut(DataT mask, bool openDrain, bool fast)
+            {
+                RmwPolicy::Or<DIR>(mask);
+                RmwPolicy::AndOr<OPENDRAIN>( (DataT)~mask, openDrain ? mask : 0 );
+                RmwPolicy::AndOr<SPEED>( (DataT)~mask, fast ? mask : 0 );
+                RmwPolicy::And<ANALOG>( (DataT)~mask );
+            }
+            static void ConfigureIn(DataT mask, bool pullUp, bool pullDown, bool isAnalog)
+            {
+                RmwPolicy::And<DIR>( (DataT)~mask );
+                RmwPolicy::AndOr<PULLUP>( (DataT)~mask, pullUp ? mask : 0 );
+                RmwPolicy::AndOr<PULLDOWN>( (DataT)~mask, pullDown ? mask : 0 );
+                RmwPolicy::AndOr<ANALOG>( (DataT)~mask, isAnalog ? mask : 0 );
+            }
+        public:
+            //=============Generic API. Everybody should implement and respect it==============
+    		static void Write(DataT value){ OUT::Set(value); }	//Write to GPIO output register
+			static DataT Read(){ return IN::Value(); }			//Read GPIO input register
+            static DataT ReadOutReg(){ return OUT::Value(); }	//Read GPIO output register
+            //read-modify-write operations are protected according to TRIO_RMW_POLICY, see trio_atomic.hpp
+            static void Set(DataT value){ RmwPolicy::Or<OUT>(value); }
+    		static void Clear(DataT value){ RmwPolicy::And<OUT>( (DataT)~value ); }
+            static void ClearAndSet(DataT clearMask, DataT value){ RmwPolicy::AndOr<OUT>((DataT)~clearMask, value); }
+    		static void Toggle(DataT value){ RmwPolicy::Xor<OUT>(value); }
+
+            template<DataT value>
+    		static void Set(){ RmwPolicy::Or<OUT, value>(); }
+    		template<DataT value>
+    		static void Clear(){ RmwPolicy::And<OUT, (DataT)~value>(); }
+            template<DataT clearMask, DataT value>
+    		static void ClearAndSet(){ RmwPolicy::AndOr<OUT, (DataT)~clearMask, value>(); }
+            template<DataT value>
+    		static void Toggle(){ RmwPolicy::Xor<OUT, value>(); }
+
+            //Read only pins in MASK. Ports may read single pin faster
+            template<DataT MASK>
+            static DataT Read(){ return (DataT)(Read() & MASK); }
+
+            struct Configure
+            {
+                template<DataT MASK>
+                static void OutPushPull_Slow(){ ConfigureOut<MASK, false, false>(); }
+                template<DataT MASK>
+                static void OutPushPull_Medium(){ OutPushPull_Fast<MASK>(); }
+                template<DataT MASK>
+                static void OutPushPull_Fast(){ ConfigureOut<MASK, false, true>(); }
+                template<DataT MASK>
+                static void OutOpenDrain_Slow(){ ConfigureOut<MASK, true, false>(); }
+                template<DataT MASK>
+                static void OutOpenDrain_Medium(){ OutOpenDrain_Fast<MASK>(); }
+                template<DataT MASK>
+                static void OutOpenDrain_Fast(){ ConfigureOut<MASK, true, true>(); }
+
+                template<DataT MASK>
+                static void InFloating(){ ConfigureIn<MASK, false, false, false>(); }
+                template<DataT MASK>
+                static void InPullUp(){ ConfigureIn<MASK, true, false, false>(); }
+                template<DataT MASK>
+                static void InPullDown(){ ConfigureIn<MASK, false, true, false>(); }
+                template<DataT MASK>
+                static void InAnalog(){ ConfigureIn<MASK, false, false, true>(); }
+
+                template<DataT MASK>
+                static void EnableAF(){ RmwPolicy::Or<AF, MASK>(); }
+                template<DataT MASK>
+                static void DisableAF(){ RmwPolicy::And<AF, (DataT)~MASK>(); }
+                template<DataT MASK>
+                static void EnableInterrupt(){ RmwPolicy::Or<IRQ, MASK>(); }
+                template<DataT MASK>
+                static void DisableInterrupt(){ RmwPolicy::And<IRQ, (DataT)~MASK>(); }
+
+                //Same configurations with runtime mask
+                static void OutPushPull_Slow(DataT mask){ ConfigureOut( mask, false, false ); }
+                static void OutPushPull_Medium(DataT mask){ OutPushPull_Fast(mask); }
+                static void OutPushPull_Fast(DataT mask){ ConfigureOut( mask, false, true ); }
+                static void OutOpenDrain_Slow(DataT mask){ ConfigureOut( mask, true, false ); }
+                static void OutOpenDrain_Medium(DataT mask){ OutOpenDrain_Fast(mask); }
+                static void OutOpenDrain_Fast(DataT mask){ ConfigureOut( mask, true, true ); }
+
+                static void InFloating(DataT mask){ ConfigureIn( mask, false, false, false ); }
+                static void InPullUp(DataT mask){ ConfigureIn( mask, true, false, false ); }
+                static void InPullDown(DataT mask){ ConfigureIn( mask, false, true, false ); }
+                static void InAnalog(DataT mask){ ConfigureIn( mask, false, false, true ); }
+
+                static void EnableAF(DataT mask){ RmwPolicy::Or<AF>(mask); }
+                static void DisableAF(DataT mask){ RmwPolicy::And<AF>( (DataT)~mask ); }
+                static void EnableInterrupt(DataT mask){ RmwPolicy::Or<IRQ>(mask); }
+                static void DisableInterrupt(DataT mask){ RmwPolicy::And<IRQ>( (DataT)~mask ); }
+            };
+
+            //=============Hardware specific API for maximum flexibility======================
+            //TPin will expose this API to users as Pxn::HWSpecificAPI::HWSpecific_method();
+            //Some operations may need MASK to work, TPin will provide it.
+            template< DataT MASK=0 >
+            struct HWSpecificAPI
+            {
+                //Simulate external signal on input pins. Pins out of MASK are not touched(MASK=0 means whole port)
+                static void DriveInputs(DataT value)
+                {
+                    const DataT mask = MASK ? MASK : (DataT)~0;
+                    RmwPolicy::AndOr<IN>( (DataT)~mask, (DataT)(value & mask) );
+                }
+                //Connect outputs to inputs
+                static void Loopback(){ DriveInputs( OUT::Value() ); }
+                static HostGpioRegs &GetGPIORegsReference(){ return T::GetPortStuct(); }
+            };
+    	};//PortImplimentation
+    }//namespace Private
+
+#define MAKE_PORT(className, ID) \
+        class className :public Private::PortImplimentation<className>{\
+            static Private::HostGpioRegs &GetPortStuct(){ return Private::HostGpioStorage<ID>::Regs; }\
+            friend class Private::PortImplimentation<className>;\
+            public:\
+            enum{Id = ID};\
+        };
+
+    #define TRIO_HAS_PORTA
+    MAKE_PORT(Porta, 'A')
+    #define TRIO_HAS_PORTB
+    MAKE_PORT(Portb, 'B')
+    #define TRIO_HAS_PORTC
+    MAKE_PORT(Portc, 'C')
+    #define TRIO_HAS_PORTD
+    MAKE_PORT(Portd, 'D')
+}//namespace TRIO
+#endif /*TRIO_GPIO_IMPLEMENTATION_HPP_HOST_*/
@@ -0,0 +1,496 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#ifndef TRIO_GPIO_IMPLEMENTATION_HPP_LINUX_
+#define TRIO_GPIO_IMPLEMENTATION_HPP_LINUX_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+/*Linux GPIO character device port(uAPI v2, kernel 5.10+)
+*
+* Each port is a bank of 32 lines of one gpiochip. All configured lines of the port are held by ONE line request,
+* so every port operation is one syscall regardless of count of pins:
+* Write/Set/Clear/ClearAndSet/Toggle - one GPIO_V2_LINE_SET_VALUES_IOCTL with bits/mask pair
+* Read                                - one GPIO_V2_LINE_GET_VALUES_IOCTL
+* ReadOutReg                          - no syscall, output values are cached
+* PinList with all pins in one port is mapped to exactly one line request.
+*
+* Lines are requested when they are configured. Line that was never configured is not requested,
+* writes to it are ignored and it reads as 0. Configuring new line re-requests the whole port
+* (request is released and made again with current output values), so configure all lines at start up.
+* Configuring lines that are already requested is one GPIO_V2_LINE_SET_CONFIG_IOCTL.
+*
+* Ports are defined by macros(define them before #include "trio.hpp"):
+* #define TRIO_LINUX_PORTA_CHIP "/dev/gpiochip0"
+* #define TRIO_LINUX_PORTA_BASE 0       //first chip line of the port, default is 0
+* Ports A..H are supported. If no port is defined then Porta is gpiochip0 lines 0..31 and Portb is gpiochip0 lines 32..63
+*
+* Syscalls are done by TRIO_LINUX_GPIO_DRIVER class, default is Private::LinuxGpioSyscalls.
+* Define it to your own class with the same static methods to run against fake chip in tests.
+*
+* Port methods don't return errors. errno of last failed syscall is kept, see HWSpecificAPI::LastError()
+*
+* Edge events of lines with EnableInterrupt are read in batches by LineEventReader, see trio_line_events.hpp */
+
+//define to know on what MCU we are running
+//#define TRIO_STM8_PORT_
+//#define TRIO_STM32_PORT_
+//#define TRIO_AVR_PORT_
+//#define TRIO_XMEGA_PORT_
+#define TRIO_LINUX_PORT_
+
+#include <linux/gpio.h>
+#include <sys/types.h>
+#include <sys/ioctl.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+namespace TRIO
+{
+    namespace Private
+    {
+        //Default driver. Same return values and errno as syscalls
+        struct LinuxGpioSyscalls
+        {
+            static int Open(const char *path){ return ::open(path, O_RDWR | O_CLOEXEC); }
+            static int Close(int fd){ return ::close(fd); }
+            static int Ioctl(int fd, unsigned long request, void *arg){ return ::ioctl(fd, request, arg); }
+            static ssize_t Read(int fd, void *buf, size_t count){ return ::read(fd, buf, count); }
+        };
+    }//namespace Private
+
+#ifndef TRIO_LINUX_GPIO_DRIVER
+    #define TRIO_LINUX_GPIO_DRIVER Private::LinuxGpioSyscalls
+#endif
+
+    namespace Private
+    {
+        struct NativePortBase
+        {
+            typedef uint32_t DataT;
+            enum{ Width = sizeof(DataT) * CHAR_BITS };
+            //No GPIO clock gating, see trio_clock_gating.hpp
+            typedef NullRegister ClockEnableReg;
+            static const uint32_t ClockEnableMask = 0;
+        };//struct NativePortBase
+
+        //Runtime state of one port
+        struct LinuxPortState
+        {
+            bool chipOpened;
+            bool requested;         //line request is active
+            int chipFd;
+            int requestFd;
+            uint32_t requestedLines;    //port bits held by line request
+            uint32_t outputLines;       //port bits configured as outputs. Only these may be written by SET_VALUES
+            uint32_t outputs;           //cached output values
+            int lastError;              //errno of last failed syscall
+            uint64_t flags[NativePortBase::Width];  //GPIO_V2_LINE_FLAG_XXX for each line, 0 - line is not used
+            uint8_t requestIndex[NativePortBase::Width];    //port bit -> index in line request
+        };
+
+        //Static storage for port state. Zero initialized before any constructor runs
+        template< class PORT >
+        struct LinuxPortStorage{ static LinuxPortState State; };
+
+        template< class PORT >
+        LinuxPortState LinuxPortStorage<PORT>::State;
+
+        template< class T >
+    	class PortImplimentation: public NativePortBase
+        {
+            typedef TRIO_LINUX_GPIO_DRIVER Driver;
+
+            static const uint64_t EdgeFlags = GPIO_V2_LINE_FLAG_EDGE_RISING | GPIO_V2_LINE_FLAG_EDGE_FALLING;
+            static const uint64_t ModeFlags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_OUTPUT | GPIO_V2_LINE_FLAG_OPEN_DRAIN
+                                            | GPIO_V2_LINE_FLAG_BIAS_PULL_UP | GPIO_V2_LINE_FLAG_BIAS_PULL_DOWN
+                                            | GPIO_V2_LINE_FLAG_BIAS_DISABLED;
+
+            static LinuxPortState &State(){ return LinuxPortStorage<T>::State; }
+
+            static void Error(){ State().lastError = errno; }
+
+            //port bits -> line request bits
+            static uint64_t ToRequestBits(DataT portBits)
+            {
+                LinuxPortState &st = State();
+                uint64_t result = 0;
+                portBits &= st.requestedLines;
+                for( uint8_t bit = 0; portBits; ++bit, portBits >>= 1 )
+                    if( portBits & 1 )
+                        result |= (uint64_t)1 << st.requestIndex[bit];
+                return result;
+            }
+            //line request bits -> port bits
+            static DataT FromRequestBits(uint64_t requestBits)
+            {
+                LinuxPortState &st = State();
+                DataT result = 0;
+                for( uint8_t bit = 0; bit < Width; ++bit )
+                    if( (st.requestedLines & ((DataT)1 << bit)) && (requestBits & ((uint64_t)1 << st.requestIndex[bit])) )
+                        result |= (DataT)1 << bit;
+                return result;
+            }
+
+            //Lines with same flags are grouped into one attribute. First group goes to config.flags
+            static bool BuildConfig(gpio_v2_line_config &config)
+            {
+                LinuxPortState &st = State();
+                memset( &config, 0, sizeof(config) );
+                const uint32_t MaxFlagAttrs = GPIO_V2_LINE_NUM_ATTRS_MAX - 1;   //one is reserved for output values
+                bool defaultTaken = false;
+                uint32_t grouped = 0;
+                uint32_t outputLines = 0;
+                for( uint8_t bit = 0; bit < Width; ++bit )
+                {
+                    const DataT bitMask = (DataT)1 << bit;
+                    if( !(st.requestedLines & bitMask) )
+                        continue;
+                    if( st.flags[bit] & GPIO_V2_LINE_FLAG_OUTPUT )
+                        outputLines |= bitMask;
+                    if( grouped & bitMask )
+                        continue;
+                    //collect all lines with same flags
+                    uint32_t group = 0;
+                    for( uint8_t other = bit; other < Width; ++other )
+                        if( (st.requestedLines & ((DataT)1 << other)) && st.flags[other] == st.flags[bit] )
+                            group |= (DataT)1 << other;
+                    grouped |= group;
+
+                    if( !defaultTaken )
+                    {
+                        config.flags = st.flags[bit];
+                        defaultTaken = true;
+                    }
+                    else
+                    {
+                        if( config.num_attrs >= MaxFlagAttrs )
+                        {
+                            st.lastError = E2BIG;   //too many different line configurations in one port
+                            return false;
+                        }
+                        gpio_v2_line_config_attribute &attr = config.attrs[config.num_attrs++];
+                        attr.attr.id = GPIO_V2_LINE_ATTR_ID_FLAGS;
+                        attr.attr.flags = st.flags[bit];
+                        attr.mask = ToRequestBits( group );
+                    }
+                }
+                if( outputLines )
+                {
+                    gpio_v2_line_config_attribute &attr = config.attrs[config.num_attrs++];
+                    attr.attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+                    attr.attr.values = ToRequestBits( st.outputs );
+                    attr.mask = ToRequestBits( outputLines );
+                }
+                return true;
+            }
+
+            //Release current line request and request all used lines again
+            static void Request()
+            {
+                LinuxPortState &st = State();
+                if( !st.chipOpened )
+                {
+                    st.chipFd = Driver::Open( T::ChipPath() );
+                    if( st.chipFd < 0 )
+                        return Error();
+                    st.chipOpened = true;
+                }
+                Release();
+
+                gpio_v2_line_request request;
+                memset( &request, 0, sizeof(request) );
+                strncpy( request.consumer, "trio", sizeof(request.consumer) - 1 );
+                st.requestedLines = 0;
+                for( uint8_t bit = 0; bit < Width; ++bit )
+                {
+                    if( st.flags[bit] == 0 )
+                        continue;
+                    st.requestIndex[bit] = (uint8_t)request.num_lines;
+                    request.offsets[request.num_lines++] = T::LineBase + bit;
+                    st.requestedLines |= (DataT)1 << bit;
+                }
+                if( request.num_lines == 0 )
+                    return;
+                if( !BuildConfig( request.config ) )
+                {
+                    st.requestedLines = 0;
+                    return;
+                }
+                if( Driver::Ioctl( st.chipFd, GPIO_V2_GET_LINE_IOCTL, &request ) < 0 )
+                {
+                    st.requestedLines = 0;
+                    return Error();
+                }
+                st.requestFd = request.fd;
+                st.requested = true;
+            }
+
+            //Change flags of MASK lines. One SET_CONFIG ioctl, or new line request if there are new lines
+            static void Reconfigure(DataT mask, uint64_t clearFlags, uint64_t setFlags)
+            {
+                LinuxPortState &st = State();
+                for( uint8_t bit = 0; bit < Width; ++bit )
+                    if( mask & ((DataT)1 << bit) )
+                    {
+                        st.flags[bit] = (st.flags[bit] & ~clearFlags) | setFlags;
+                        if( st.flags[bit] & GPIO_V2_LINE_FLAG_OUTPUT )
+                            st.outputLines |= (DataT)1 << bit;
+                        else
+                            st.outputLines &= ~((DataT)1 << bit);
+                    }
+
+                if( !st.requested || (mask & ~st.requestedLines) )
+                    return Request();
+
+                gpio_v2_line_config config;
+                if( BuildConfig( config ) && Driver::Ioctl( st.requestFd, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config ) < 0 )
+                    Error();
+            }
+
+            static void SetMode(DataT mask, uint64_t modeFlags){ Reconfigure( mask, ModeFlags, modeFlags ); }
+        public:
+            //=============Generic API. Everybody should implement and respect it==============
+            static void Write(DataT value){ ClearAndSet( (DataT)~0, value ); }		//Write to GPIO output register
+            static DataT Read()      //Read GPIO input register
+            {
+                LinuxPortState &st = State();
+                if( !st.requested )
+                    return 0;
+                gpio_v2_line_values values;
+                values.bits = 0;
+                values.mask = ToRequestBits( st.requestedLines );
+                if( Driver::Ioctl( st.requestFd, GPIO_V2_LINE_GET_VALUES_IOCTL, &values ) < 0 )
+                {
+                    Error();
+                    return 0;
+                }
+                return FromRequestBits( values.bits );
+            }
+            static DataT ReadOutReg(){ return State().outputs; }		//Read GPIO output register(cached)
+            static void Set(DataT value){ ClearAndSet( 0, value ); }
+    		static void Clear(DataT value){ ClearAndSet( value, 0 ); }
+            //Only requested output lines are written: kernel rejects whole SET_VALUES with EPERM if mask has an input line
+            static void ClearAndSet(DataT clearMask, DataT value)
+            {
+                LinuxPortState &st = State();
+                const DataT mask = (DataT)(clearMask | value) & st.requestedLines & st.outputLines;
+                if( !mask )
+                    return;
+                const DataT newOutputs = (DataT)((st.outputs & ~clearMask) | value);
+                gpio_v2_line_values values;
+                values.bits = ToRequestBits( newOutputs & mask );
+                values.mask = ToRequestBits( mask );
+                if( Driver::Ioctl( st.requestFd, GPIO_V2_LINE_SET_VALUES_IOCTL, &values ) < 0 )
+                    return Error();
+                st.outputs = (st.outputs & ~mask) | (newOutputs & mask);
+            }
+    		static void Toggle(DataT value){ ClearAndSet( value & State().outputs, value & ~State().outputs ); }
+
+            template<DataT value>
+    		static void Set(){ Set(value); }
+    		template<DataT value>
+    		static void Clear(){ Clear(value); }
+            template<DataT clearMask, DataT value>
+    		static void ClearAndSet(){ ClearAndSet(clearMask, value); }
+            template<DataT value>
+    		static void Toggle(){ Toggle(value); }
+
+            //Read only pins in MASK. Ports may read single pin faster
+            template<DataT MASK>
+            static DataT Read(){ return (DataT)(Read() & MASK); }
+
+            struct Configure
+            {
+                //there is no speed setting in Linux GPIO
+                template<DataT MASK>
+                static void OutPushPull_Slow(){ OutPushPull_Fast<MASK>(); }
+                template<DataT MASK>
+                static void OutPushPull_Medium(){ OutPushPull_Fast<MASK>(); }
+                template<DataT MASK>
+                static void OutPushPull_Fast(){ PortImplimentation::SetMode( MASK, GPIO_V2_LINE_FLAG_OUTPUT ); }
+                template<DataT MASK>
+                static void OutOpenDrain_Slow(){ OutOpenDrain_Fast<MASK>(); }
+                template<DataT MASK>
+                static void OutOpenDrain_Medium(){ OutOpenDrain_Fast<MASK>(); }
+                template<DataT MASK>
+                static void OutOpenDrain_Fast(){ PortImplimentation::SetMode( MASK, GPIO_V2_LINE_FLAG_OUTPUT | GPIO_V2_LINE_FLAG_OPEN_DRAIN ); }
+
+                template<DataT MASK>
+                static void InFloating(){ PortImplimentation::SetMode( MASK, GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_BIAS_DISABLED ); }
+                template<DataT MASK>
+                static void InPullUp(){ PortImplimentation::SetMode( MASK, GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_BIAS_PULL_UP ); }
+                template<DataT MASK>
+                static void InPullDown(){ PortImplimentation::SetMode( MASK, GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_BIAS_PULL_DOWN ); }
+                template<DataT MASK>
+                static void InAnalog(){ PortImplimentation::SetMode( MASK, GPIO_V2_LINE_FLAG_INPUT ); } //no analog in GPIO chardev
+
+                template<DataT MASK>
+                static void EnableAF(){ }   //pin muxing is not done by GPIO chardev
+                template<DataT MASK>
+                static void DisableAF(){ }  //pin muxing is not done by GPIO chardev
+                //Edge detection on both edges. Please apply this to INPUT pins only!
+                template<DataT MASK>
+                static void EnableInterrupt(){ Reconfigure( MASK, EdgeFlags, EdgeFlags ); }
+                template<DataT MASK>
+                static void DisableInterrupt(){ Reconfigure( MASK, EdgeFlags, 0 ); }
+
+                //Same configurations with runtime mask
+                static void OutPushPull_Slow(DataT mask){ OutPushPull_Fast(mask); }
+                static void OutPushPull_Medium(DataT mask){ OutPushPull_Fast(mask); }
+                static void OutPushPull_Fast(DataT mask){ PortImplimentation::SetMode( mask, GPIO_V2_LINE_FLAG_OUTPUT ); }
+                static void OutOpenDrain_Slow(DataT mask){ OutOpenDrain_Fast(mask); }
+                static void OutOpenDrain_Medium(DataT mask){ OutOpenDrain_Fast(mask); }
+                static void OutOpenDrain_Fast(DataT mask){ PortImplimentation::SetMode( mask, GPIO_V2_LINE_FLAG_OUTPUT | GPIO_V2_LINE_FLAG_OPEN_DRAIN ); }
+
+                static void InFloating(DataT mask){ PortImplimentation::SetMode( mask, GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_BIAS_DISABLED ); }
+                static void InPullUp(DataT mask){ PortImplimentation::SetMode( mask, GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_BIAS_PULL_UP ); }
+                static void InPullDown(DataT mask){ PortImplimentation::SetMode( mask, GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_BIAS_PULL_DOWN ); }
+                static void InAnalog(DataT mask){ PortImplimentation::SetMode( mask, GPIO_V2_LINE_FLAG_INPUT ); }
+
+                static void EnableAF(DataT mask){ }
+                static void DisableAF(DataT mask){ }
+                static void EnableInterrupt(DataT mask){ Reconfigure( mask, EdgeFlags, EdgeFlags ); }
+                static void DisableInterrupt(DataT mask){ Reconfigure( mask, EdgeFlags, 0 ); }
+            };
+
+            //=============Hardware specific API for maximum flexibility======================
+            //TPin will expose this API to users as Pxn::HWSpecificAPI::HWSpecific_method();
+            //Some operations may need MASK to work, TPin will provide it.
+            template< DataT MASK=0 >
+            struct HWSpecificAPI
+            {
+                //errno of last failed syscall, 0 if there was no errors
+                static int LastError(){ return State().lastError; }
+                static void ClearError(){ State().lastError = 0; }
+                //line request file descriptor(for poll()/select()), -1 if nothing is requested
+                static int GetRequestFd(){ return State().requested ? State().requestFd : -1; }
+                //Port bit -> line request index map. Used by line event reader
+                static uint8_t GetRequestIndex(uint8_t bit){ return State().requestIndex[bit]; }
+                static DataT GetRequestedLines(){ return State().requestedLines; }
+                //Chip line number of port bit 0
+                static uint32_t GetLineBase(){ return T::LineBase; }
+                //Release all lines of the port. Configuration is kept and lines will be requested again by next configure
+                static void ReleaseLines(){ Release(); }
+            };
+        private:
+            static void Release()
+            {
+                LinuxPortState &st = State();
+                if( st.requested )
+                    Driver::Close( st.requestFd );
+                st.requested = false;
+            }
+    	};//PortImplimentation
+    }//namespace Private
+
+//CHIP - gpiochip device path, BASE - chip line number of port bit 0
+#define MAKE_PORT(className, ID, CHIP, BASE) \
+        class className :public Private::PortImplimentation<className>{\
+            static const char *ChipPath(){ return CHIP; }\
+            static const uint32_t LineBase = BASE;\
+            friend class Private::PortImplimentation<className>;\
+            public:\
+            enum{Id = ID};\
+        };
+
+#if !defined(TRIO_LINUX_PORTA_CHIP) && !defined(TRIO_LINUX_PORTB_CHIP) && !defined(TRIO_LINUX_PORTC_CHIP) && !defined(TRIO_LINUX_PORTD_CHIP) \
+    && !defined(TRIO_LINUX_PORTE_CHIP) && !defined(TRIO_LINUX_PORTF_CHIP) && !defined(TRIO_LINUX_PORTG_CHIP) && !defined(TRIO_LINUX_PORTH_CHIP)
+    #define TRIO_LINUX_PORTA_CHIP "/dev/gpiochip0"
+    #define TRIO_LINUX_PORTA_BASE 0
+    #define TRIO_LINUX_PORTB_CHIP "/dev/gpiochip0"
+    #define TRIO_LINUX_PORTB_BASE 32
+#endif
+
+#ifdef TRIO_LINUX_PORTA_CHIP
+    #ifndef TRIO_LINUX_PORTA_BASE
+        #define TRIO_LINUX_PORTA_BASE 0
+    #endif
+	#define TRIO_HAS_PORTA
+    MAKE_PORT(Porta, 'A', TRIO_LINUX_PORTA_CHIP, TRIO_LINUX_PORTA_BASE)
+#endif
+
+#ifdef TRIO_LINUX_PORTB_CHIP
+    #ifndef TRIO_LINUX_PORTB_BASE
+        #define TRIO_LINUX_PORTB_BASE 0
+    #endif
+	#define TRIO_HAS_PORTB
+    MAKE_PORT(Portb, 'B', TRIO_LINUX_PORTB_CHIP, TRIO_LINUX_PORTB_BASE)
+#endif
+
+#ifdef TRIO_LINUX_PORTC_CHIP
+    #ifndef TRIO_LINUX_PORTC_BASE
+        #define TRIO_LINUX_PORTC_BASE 0
+    #endif
+	#define TRIO_HAS_PORTC
+    MAKE_PORT(Portc, 'C', TRIO_LINUX_PORTC_CHIP, TRIO_LINUX_PORTC_BASE)
+#endif
+
+#ifdef TRIO_LINUX_PORTD_CHIP
+    #ifndef TRIO_LINUX_PORTD_BASE
+        #define TRIO_LINUX_PORTD_BASE 0
+    #endif
+	#define TRIO_HAS_PORTD
+    MAKE_PORT(Portd, 'D', TRIO_LINUX_PORTD_CHIP, TRIO_LINUX_PORTD_BASE)
+#endif
+
+#ifdef TRIO_LINUX_PORTE_CHIP
+    #ifndef TRIO_LINUX_PORTE_BASE
+        #define TRIO_LINUX_PORTE_BASE 0
+    #endif
+	#define TRIO_HAS_PORTE
+    MAKE_PORT(Porte, 'E', TRIO_LINUX_PORTE_CHIP, TRIO_LINUX_PORTE_BASE)
+#endif
+
+#ifdef TRIO_LINUX_PORTF_CHIP
+    #ifndef TRIO_LINUX_PORTF_BASE
+        #define TRIO_LINUX_PORTF_BASE 0
+    #endif
+	#define TRIO_HAS_PORTF
+    MAKE_PORT(Portf, 'F', TRIO_LINUX_PORTF_CHIP, TRIO_LINUX_PORTF_BASE)
+#endif
+
+#ifdef TRIO_LINUX_PORTG_CHIP
+    #ifndef TRIO_LINUX_PORTG_BASE
+        #define TRIO_LINUX_PORTG_BASE 0
+    #endif
+	#define TRIO_HAS_PORTG
+    MAKE_PORT(Portg, 'G', TRIO_LINUX_PORTG_CHIP, TRIO_LINUX_PORTG_BASE)
+#endif
+
+#ifdef TRIO_LINUX_PORTH_CHIP
+    #ifndef TRIO_LINUX_PORTH_BASE
+        #define TRIO_LINUX_PORTH_BASE 0
+    #endif
+	#define TRIO_HAS_PORTH
+    MAKE_PORT(Porth, 'H', TRIO_LINUX_PORTH_CHIP, TRIO_LINUX_PORTH_BASE)
+#endif
+}//namespace TRIO
+#endif /*TRIO_GPIO_IMPLEMENTATION_HPP_LINUX_*/
@@ -0,0 +1,262 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#ifndef TRIO_LINE_EVENTS_HPP_LINUX_
+#define TRIO_LINE_EVENTS_HPP_LINUX_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+#ifndef TRIO_LINUX_PORT_
+	#error "This file related to Linux port! /Linux/trio_gpio_implementation.hpp should define TRIO_LINUX_PORT_ macro"
+#endif
+
+/*Batched edge events of PinList inputs(Linux GPIO character device)
+*
+* Instead of polling Read(), kernel edge events(gpio_v2_line_event) are read from line request of each port.
+* One read() per port takes as many events as there is free space in the ring buffer.
+* Every event is converted to PinList bit masks and keeps its kernel timestamp, so no edge is lost between polls.
+*
+* typedef PinList<Pa4, Pa5, Pa17Inv> Sensors;
+* Sensors::Configure::InPullUp<0x07>();
+* Sensors::Configure::EnableInterrupt<0x07>();   //lines are requested with both edges detection
+*
+* TRIO::LineEventReader<Sensors, 256> reader;     //preallocated, no heap
+* struct pollfd fds[reader.PortsCount];
+* for(;;)
+* {
+*     poll( fds, reader.GetPollFds(fds), -1 );
+*     reader.Fill( fds );                         //reads only ports that are ready, never blocks
+*     TRIO::LineEventReader<Sensors, 256>::Event ev;
+*     while( reader.Pop(ev) )
+*         Process( ev.timestampNs, ev.rising, ev.falling );
+* }
+*
+* Inverted pins report active edges: falling line edge of inverted pin is reported in Event::rising.
+* One reader reads all ports of its PinList. Each port has one line request and its events are consumed by read(),
+* so a port must not be read by two readers: they would take each other's events.
+* Events of port lines that are not in PinList are dropped.
+* Kernel keeps events in its own buffer until they are read. If it overflows, lost events are counted by Lost().
+* Reads are done by TRIO_LINUX_GPIO_DRIVER, so reader can be tested with fake event source. */
+
+#include <poll.h>
+
+namespace TRIO
+{
+    //One edge event mapped to PinList bits. Only one of rising and falling is not 0
+    template< class DataT >
+    struct LineEvent
+    {
+        uint64_t timestampNs;   //kernel timestamp, CLOCK_MONOTONIC by default
+        DataT rising;           //PinList bit of pin that became active
+        DataT falling;          //PinList bit of pin that became inactive
+        uint32_t seqno;         //sequence number of event in line request of the port
+    };
+
+    namespace Private
+    {
+        //Port bit -> PinList mask table for pins of PORT. LIST is list of TPinWrapper
+        template< class PORT, class LIST >
+        struct LineEventMapBuilder
+        {
+            template< class DataT >
+            static void Build(DataT *){ }
+        };
+
+        template< class PORT, class Head, class Tail >
+        struct LineEventMapBuilder< PORT, Loki::Typelist<Head, Tail> >
+        {
+            template< class DataT >
+            static void Build(DataT *listMasks)
+            {
+                if( IfBelongsToPort<Head, PORT>::value )
+                    listMasks[Head::Pin::TRIOInternals::PortPinNumber] |= mfCalcPinListMask<Head>::value;
+                LineEventMapBuilder<PORT, Tail>::Build( listMasks );
+            }
+        };
+
+        //Calls READER methods for each port. I is port index
+        template< class PORTS, unsigned I = 0 >
+        struct LineEventPortsWalker
+        {
+            template< class READER >
+            static void Build(READER &){ }
+            template< class READER >
+            static unsigned Fill(READER &, const struct pollfd *){ return 0; }
+            template< class READER >
+            static void GetPollFds(READER &, struct pollfd *){ }
+        };
+
+        template< class Head, class Tail, unsigned I >
+        struct LineEventPortsWalker< Loki::Typelist<Head, Tail>, I >
+        {
+            template< class READER >
+            static void Build(READER &r){ r.template BuildPort<Head>(I); LineEventPortsWalker<Tail, I + 1>::Build( r ); }
+            template< class READER >
+            static unsigned Fill(READER &r, const struct pollfd *ready)
+            {
+                unsigned count = 0;
+                if( !ready || (ready[I].revents & POLLIN) )
+                    count = r.template FillPort<Head>(I);
+                return count + LineEventPortsWalker<Tail, I + 1>::Fill( r, ready );
+            }
+            template< class READER >
+            static void GetPollFds(READER &r, struct pollfd *fds)
+            {
+                fds[I].fd = Head::template HWSpecificAPI<>::GetRequestFd();
+                fds[I].events = POLLIN;
+                fds[I].revents = 0;
+                LineEventPortsWalker<Tail, I + 1>::GetPollFds( r, fds );
+            }
+        };
+    }//namespace Private
+
+    /*PINLIST - PinList of inputs with EnableInterrupt
+    * CAPACITY - events in ring buffer, power of 2. Also max events taken by one read() */
+    template< class PINLIST, unsigned CAPACITY = 64 >
+    class LineEventReader
+    {
+        BOOST_STATIC_ASSERT( CAPACITY && !(CAPACITY & (CAPACITY - 1)) );
+
+        typedef TRIO_LINUX_GPIO_DRIVER Driver;
+        typedef typename PINLIST::Ports Ports;
+        template< class, unsigned > friend struct Private::LineEventPortsWalker;
+    public:
+        typedef typename PINLIST::DataT DataT;
+        typedef LineEvent<DataT> Event;
+        static const unsigned PortsCount = Loki::TL::Length<Ports>::value;
+
+        LineEventReader(){ Private::LineEventPortsWalker<Ports>::Build( *this ); Clear(); }
+
+        //fds for poll(). Returns count of fds, PortsCount. Fd of port without line request is -1 and ignored by poll()
+        unsigned GetPollFds(struct pollfd *fds){ Private::LineEventPortsWalker<Ports>::GetPollFds( *this, fds ); return PortsCount; }
+
+        /*One read() per port. Returns count of new events.
+        * ready - result of poll() on GetPollFds(). Only ports with POLLIN are read.
+        * Without it every port is read and read() blocks if port has no events(line request fd is blocking)*/
+        unsigned Fill(const struct pollfd *ready = 0){ return Private::LineEventPortsWalker<Ports>::Fill( *this, ready ); }
+
+        bool Pop(Event &ev)
+        {
+            if( head == tail )
+                return false;
+            ev = ring[tail++ & (CAPACITY - 1)];
+            return true;
+        }
+        //Take up to max events. Returns count of events taken
+        unsigned Pop(Event *dst, unsigned max)
+        {
+            unsigned n = 0;
+            for( ; n < max && head != tail; ++n )
+                dst[n] = ring[tail++ & (CAPACITY - 1)];
+            return n;
+        }
+
+        unsigned Count() const { return head - tail; }
+        bool Empty() const { return head == tail; }
+        void Clear(){ head = tail = 0; lost = 0; lastError = 0; }
+
+        //Events lost by kernel(gaps in sequence numbers)
+        uint32_t Lost() const { return lost; }
+        //errno of last failed read(), 0 if there was no errors
+        int LastError() const { return lastError; }
+
+    private:
+        struct PortState
+        {
+            DataT listMasks[32];    //port bit -> PinList mask
+            uint32_t lastSeqno;
+        };
+
+        template< class PORT >
+        void BuildPort(unsigned index)
+        {
+            BOOST_STATIC_ASSERT( PORT::Width <= 32 );
+            PortState &ps = ports[index];
+            for( unsigned bit = 0; bit < 32; ++bit )
+                ps.listMasks[bit] = 0;
+            ps.lastSeqno = 0;
+            Private::LineEventMapBuilder<PORT, typename PINLIST::WrappedPins>::Build( ps.listMasks );
+        }
+
+        template< class PORT >
+        unsigned FillPort(unsigned index)
+        {
+            const int fd = PORT::template HWSpecificAPI<>::GetRequestFd();
+            const unsigned space = CAPACITY - Count();
+            if( fd < 0 || space == 0 )
+                return 0;
+            const ssize_t bytes = Driver::Read( fd, raw, space * sizeof(raw[0]) );
+            if( bytes < 0 )
+            {
+                lastError = errno;
+                return 0;
+            }
+
+            //PinList inversion is applied to edges
+            const typename PORT::DataT INVMASK = Private::Utils::metaForEach_bitOr<
+                    typename Private::Utils::CopyIf<typename PINLIST::WrappedPins, Private::IfBelongsToPort, PORT>::Result,
+                    Private::mfCalcPortInversionMask>::value;
+            const uint32_t lineBase = PORT::template HWSpecificAPI<>::GetLineBase();
+            PortState &ps = ports[index];
+            const unsigned count = (unsigned)bytes / sizeof(raw[0]);
+            unsigned added = 0;
+            for( unsigned i = 0; i < count; ++i )
+            {
+                const gpio_v2_line_event &e = raw[i];
+                //sequence number starts from 1 for every new line request
+                if( e.seqno > ps.lastSeqno + 1 && ps.lastSeqno != 0 )
+                    lost += e.seqno - ps.lastSeqno - 1;
+                ps.lastSeqno = e.seqno;
+
+                const uint32_t bit = e.offset - lineBase;
+                if( bit >= 32 || ps.listMasks[bit] == 0 )
+                    continue;   //line is not in PinList
+                bool rising = (e.id == GPIO_V2_LINE_EVENT_RISING_EDGE);
+                if( INVMASK & ((uint32_t)1 << bit) )
+                    rising = !rising;
+
+                Event &ev = ring[head++ & (CAPACITY - 1)];
+                ev.timestampNs = e.timestamp_ns;
+                ev.rising = rising ? ps.listMasks[bit] : 0;
+                ev.falling = rising ? 0 : ps.listMasks[bit];
+                ev.seqno = e.seqno;
+                ++added;
+            }
+            return added;
+        }
+
+        PortState ports[PortsCount];
+        Event ring[CAPACITY];
+        unsigned head;      //free running counters, ring index is counter & (CAPACITY - 1)
+        unsigned tail;
+        uint32_t lost;
+        int lastError;
+        struct gpio_v2_line_event raw[CAPACITY];    //read() buffer
+    };
+}//namespace TRIO
+#endif /*TRIO_LINE_EVENTS_HPP_LINUX_*/
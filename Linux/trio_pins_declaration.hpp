@@ -0,0 +1,322 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#ifndef TRIO_PINS_DECLARATION_HPP_
+#define TRIO_PINS_DECLARATION_HPP_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+#ifndef TRIO_LINUX_PORT_
+	#error "This file related to Linux port! /Linux/trio_gpio_implementation.hpp should define TRIO_LINUX_PORT_ macro"
+#endif 
+
+namespace TRIO
+{
+	#ifdef TRIO_HAS_PORTA
+		TRIO_DEFINE_PA0()
+		TRIO_DEFINE_PA1()
+		TRIO_DEFINE_PA2()
+		TRIO_DEFINE_PA3()
+		TRIO_DEFINE_PA4()
+		TRIO_DEFINE_PA5()
+		TRIO_DEFINE_PA6()
+		TRIO_DEFINE_PA7()
+		TRIO_DEFINE_PA8()
+		TRIO_DEFINE_PA9()
+		TRIO_DEFINE_PA10()
+		TRIO_DEFINE_PA11()
+		TRIO_DEFINE_PA12()
+		TRIO_DEFINE_PA13()
+		TRIO_DEFINE_PA14()
+		TRIO_DEFINE_PA15()
+		TRIO_DEFINE_PA16()
+		TRIO_DEFINE_PA17()
+		TRIO_DEFINE_PA18()
+		TRIO_DEFINE_PA19()
+		TRIO_DEFINE_PA20()
+		TRIO_DEFINE_PA21()
+		TRIO_DEFINE_PA22()
+		TRIO_DEFINE_PA23()
+		TRIO_DEFINE_PA24()
+		TRIO_DEFINE_PA25()
+		TRIO_DEFINE_PA26()
+		TRIO_DEFINE_PA27()
+		TRIO_DEFINE_PA28()
+		TRIO_DEFINE_PA29()
+		TRIO_DEFINE_PA30()
+		TRIO_DEFINE_PA31()
+	#endif
+
+	#ifdef TRIO_HAS_PORTB
+		TRIO_DEFINE_PB0()
+		TRIO_DEFINE_PB1()
+		TRIO_DEFINE_PB2()
+		TRIO_DEFINE_PB3()
+		TRIO_DEFINE_PB4()
+		TRIO_DEFINE_PB5()
+		TRIO_DEFINE_PB6()
+		TRIO_DEFINE_PB7()
+		TRIO_DEFINE_PB8()
+		TRIO_DEFINE_PB9()
+		TRIO_DEFINE_PB10()
+		TRIO_DEFINE_PB11()
+		TRIO_DEFINE_PB12()
+		TRIO_DEFINE_PB13()
+		TRIO_DEFINE_PB14()
+		TRIO_DEFINE_PB15()
+		TRIO_DEFINE_PB16()
+		TRIO_DEFINE_PB17()
+		TRIO_DEFINE_PB18()
+		TRIO_DEFINE_PB19()
+		TRIO_DEFINE_PB20()
+		TRIO_DEFINE_PB21()
+		TRIO_DEFINE_PB22()
+		TRIO_DEFINE_PB23()
+		TRIO_DEFINE_PB24()
+		TRIO_DEFINE_PB25()
+		TRIO_DEFINE_PB26()
+		TRIO_DEFINE_PB27()
+		TRIO_DEFINE_PB28()
+		TRIO_DEFINE_PB29()
+		TRIO_DEFINE_PB30()
+		TRIO_DEFINE_PB31()
+	#endif
+
+	#ifdef TRIO_HAS_PORTC
+		TRIO_DEFINE_PC0()
+		TRIO_DEFINE_PC1()
+		TRIO_DEFINE_PC2()
+		TRIO_DEFINE_PC3()
+		TRIO_DEFINE_PC4()
+		TRIO_DEFINE_PC5()
+		TRIO_DEFINE_PC6()
+		TRIO_DEFINE_PC7()
+		TRIO_DEFINE_PC8()
+		TRIO_DEFINE_PC9()
+		TRIO_DEFINE_PC10()
+		TRIO_DEFINE_PC11()
+		TRIO_DEFINE_PC12()
+		TRIO_DEFINE_PC13()
+		TRIO_DEFINE_PC14()
+		TRIO_DEFINE_PC15()
+		TRIO_DEFINE_PC16()
+		TRIO_DEFINE_PC17()
+		TRIO_DEFINE_PC18()
+		TRIO_DEFINE_PC19()
+		TRIO_DEFINE_PC20()
+		TRIO_DEFINE_PC21()
+		TRIO_DEFINE_PC22()
+		TRIO_DEFINE_PC23()
+		TRIO_DEFINE_PC24()
+		TRIO_DEFINE_PC25()
+		TRIO_DEFINE_PC26()
+		TRIO_DEFINE_PC27()
+		TRIO_DEFINE_PC28()
+		TRIO_DEFINE_PC29()
+		TRIO_DEFINE_PC30()
+		TRIO_DEFINE_PC31()
+	#endif
+
+	#ifdef TRIO_HAS_PORTD
+		TRIO_DEFINE_PD0()
+		TRIO_DEFINE_PD1()
+		TRIO_DEFINE_PD2()
+		TRIO_DEFINE_PD3()
+		TRIO_DEFINE_PD4()
+		TRIO_DEFINE_PD5()
+		TRIO_DEFINE_PD6()
+		TRIO_DEFINE_PD7()
+		TRIO_DEFINE_PD8()
+		TRIO_DEFINE_PD9()
+		TRIO_DEFINE_PD10()
+		TRIO_DEFINE_PD11()
+		TRIO_DEFINE_PD12()
+		TRIO_DEFINE_PD13()
+		TRIO_DEFINE_PD14()
+		TRIO_DEFINE_PD15()
+		TRIO_DEFINE_PD16()
+		TRIO_DEFINE_PD17()
+		TRIO_DEFINE_PD18()
+		TRIO_DEFINE_PD19()
+		TRIO_DEFINE_PD20()
+		TRIO_DEFINE_PD21()
+		TRIO_DEFINE_PD22()
+		TRIO_DEFINE_PD23()
+		TRIO_DEFINE_PD24()
+		TRIO_DEFINE_PD25()
+		TRIO_DEFINE_PD26()
+		TRIO_DEFINE_PD27()
+		TRIO_DEFINE_PD28()
+		TRIO_DEFINE_PD29()
+		TRIO_DEFINE_PD30()
+		TRIO_DEFINE_PD31()
+	#endif
+
+	#ifdef TRIO_HAS_PORTE
+		TRIO_DEFINE_PE0()
+		TRIO_DEFINE_PE1()
+		TRIO_DEFINE_PE2()
+		TRIO_DEFINE_PE3()
+		TRIO_DEFINE_PE4()
+		TRIO_DEFINE_PE5()
+		TRIO_DEFINE_PE6()
+		TRIO_DEFINE_PE7()
+		TRIO_DEFINE_PE8()
+		TRIO_DEFINE_PE9()
+		TRIO_DEFINE_PE10()
+		TRIO_DEFINE_PE11()
+		TRIO_DEFINE_PE12()
+		TRIO_DEFINE_PE13()
+		TRIO_DEFINE_PE14()
+		TRIO_DEFINE_PE15()
+		TRIO_DEFINE_PE16()
+		TRIO_DEFINE_PE17()
+		TRIO_DEFINE_PE18()
+		TRIO_DEFINE_PE19()
+		TRIO_DEFINE_PE20()
+		TRIO_DEFINE_PE21()
+		TRIO_DEFINE_PE22()
+		TRIO_DEFINE_PE23()
+		TRIO_DEFINE_PE24()
+		TRIO_DEFINE_PE25()
+		TRIO_DEFINE_PE26()
+		TRIO_DEFINE_PE27()
+		TRIO_DEFINE_PE28()
+		TRIO_DEFINE_PE29()
+		TRIO_DEFINE_PE30()
+		TRIO_DEFINE_PE31()
+	#endif
+
+	#ifdef TRIO_HAS_PORTF
+		TRIO_DEFINE_PF0()
+		TRIO_DEFINE_PF1()
+		TRIO_DEFINE_PF2()
+		TRIO_DEFINE_PF3()
+		TRIO_DEFINE_PF4()
+		TRIO_DEFINE_PF5()
+		TRIO_DEFINE_PF6()
+		TRIO_DEFINE_PF7()
+		TRIO_DEFINE_PF8()
+		TRIO_DEFINE_PF9()
+		TRIO_DEFINE_PF10()
+		TRIO_DEFINE_PF11()
+		TRIO_DEFINE_PF12()
+		TRIO_DEFINE_PF13()
+		TRIO_DEFINE_PF14()
+		TRIO_DEFINE_PF15()
+		TRIO_DEFINE_PF16()
+		TRIO_DEFINE_PF17()
+		TRIO_DEFINE_PF18()
+		TRIO_DEFINE_PF19()
+		TRIO_DEFINE_PF20()
+		TRIO_DEFINE_PF21()
+		TRIO_DEFINE_PF22()
+		TRIO_DEFINE_PF23()
+		TRIO_DEFINE_PF24()
+		TRIO_DEFINE_PF25()
+		TRIO_DEFINE_PF26()
+		TRIO_DEFINE_PF27()
+		TRIO_DEFINE_PF28()
+		TRIO_DEFINE_PF29()
+		TRIO_DEFINE_PF30()
+		TRIO_DEFINE_PF31()
+	#endif
+
+	#ifdef TRIO_HAS_PORTG
+		TRIO_DEFINE_PG0()
+		TRIO_DEFINE_PG1()
+		TRIO_DEFINE_PG2()
+		TRIO_DEFINE_PG3()
+		TRIO_DEFINE_PG4()
+		TRIO_DEFINE_PG5()
+		TRIO_DEFINE_PG6()
+		TRIO_DEFINE_PG7()
+		TRIO_DEFINE_PG8()
+		TRIO_DEFINE_PG9()
+		TRIO_DEFINE_PG10()
+		TRIO_DEFINE_PG11()
+		TRIO_DEFINE_PG12()
+		TRIO_DEFINE_PG13()
+		TRIO_DEFINE_PG14()
+		TRIO_DEFINE_PG15()
+		TRIO_DEFINE_PG16()
+		TRIO_DEFINE_PG17()
+		TRIO_DEFINE_PG18()
+		TRIO_DEFINE_PG19()
+		TRIO_DEFINE_PG20()
+		TRIO_DEFINE_PG21()
+		TRIO_DEFINE_PG22()
+		TRIO_DEFINE_PG23()
+		TRIO_DEFINE_PG24()
+		TRIO_DEFINE_PG25()
+		TRIO_DEFINE_PG26()
+		TRIO_DEFINE_PG27()
+		TRIO_DEFINE_PG28()
+		TRIO_DEFINE_PG29()
+		TRIO_DEFINE_PG30()
+		TRIO_DEFINE_PG31()
+	#endif
+
+	#ifdef TRIO_HAS_PORTH
+		TRIO_DEFINE_PH0()
+		TRIO_DEFINE_PH1()
+		TRIO_DEFINE_PH2()
+		TRIO_DEFINE_PH3()
+		TRIO_DEFINE_PH4()
+		TRIO_DEFINE_PH5()
+		TRIO_DEFINE_PH6()
+		TRIO_DEFINE_PH7()
+		TRIO_DEFINE_PH8()
+		TRIO_DEFINE_PH9()
+		TRIO_DEFINE_PH10()
+		TRIO_DEFINE_PH11()
+		TRIO_DEFINE_PH12()
+		TRIO_DEFINE_PH13()
+		TRIO_DEFINE_PH14()
+		TRIO_DEFINE_PH15()
+		TRIO_DEFINE_PH16()
+		TRIO_DEFINE_PH17()
+		TRIO_DEFINE_PH18()
+		TRIO_DEFINE_PH19()
+		TRIO_DEFINE_PH20()
+		TRIO_DEFINE_PH21()
+		TRIO_DEFINE_PH22()
+		TRIO_DEFINE_PH23()
+		TRIO_DEFINE_PH24()
+		TRIO_DEFINE_PH25()
+		TRIO_DEFINE_PH26()
+		TRIO_DEFINE_PH27()
+		TRIO_DEFINE_PH28()
+		TRIO_DEFINE_PH29()
+		TRIO_DEFINE_PH30()
+		TRIO_DEFINE_PH31()
+	#endif
+
+}//namespace TRIO
+
+#endif /*TRIO_PINS_DECLARATION_HPP_*/
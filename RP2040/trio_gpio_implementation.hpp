@@ -0,0 +1,294 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#ifndef TRIO_GPIO_IMPLEMENTATION_HPP_RP2040_
+#define TRIO_GPIO_IMPLEMENTATION_HPP_RP2040_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+/*RP2040 single-cycle IO(SIO) port
+*
+* SIO has separate SET/CLR/XOR registers for output and output enable, so every port operation is one store:
+* Set     - GPIO_OUT_SET
+* Clear   - GPIO_OUT_CLR
+* Toggle  - GPIO_OUT_XOR
+* Write   - GPIO_OUT
+* ClearAndSet - GPIO_OUT_CLR then GPIO_OUT_SET(two stores, set wins)
+* Direction - GPIO_OE_SET/GPIO_OE_CLR
+* No read-modify-write at all, so TRIO_RMW_POLICY is not used by this port. It is also safe for both cores.
+*
+* Porta is GPIO0..GPIO29(user bank), DataT is 32 bit.
+*
+* Configure also writes pad control(PADS_BANK0) and selects SIO function in IO_BANK0 for each pin in MASK.
+* Pad and interrupt registers are written through atomic SET/CLR aliases(+0x2000/+0x3000), no RMW too.
+*
+* Register blocks are defined by base address macros, define them before #include "trio.hpp" to run on RAM:
+* TRIO_RP2040_SIO_BASE        - 0xd0000000, at least 0x30 bytes
+* TRIO_RP2040_IO_BANK0_BASE   - 0x40014000, at least 0x4000 bytes(atomic aliases)
+* TRIO_RP2040_PADS_BANK0_BASE - 0x4001c000, at least 0x4000 bytes(atomic aliases) */
+
+//define to know on what MCU we are running
+//#define TRIO_STM8_PORT_
+//#define TRIO_STM32_PORT_
+//#define TRIO_AVR_PORT_
+//#define TRIO_XMEGA_PORT_
+#define TRIO_RP2040_PORT_
+
+#ifndef TRIO_RP2040_SIO_BASE
+    #define TRIO_RP2040_SIO_BASE 0xd0000000u
+#endif
+#ifndef TRIO_RP2040_IO_BANK0_BASE
+    #define TRIO_RP2040_IO_BANK0_BASE 0x40014000u
+#endif
+#ifndef TRIO_RP2040_PADS_BANK0_BASE
+    #define TRIO_RP2040_PADS_BANK0_BASE 0x4001c000u
+#endif
+
+namespace TRIO
+{
+    namespace Private
+    {
+        struct NativePortBase
+        {
+            typedef uint32_t DataT;
+            enum{ Width = sizeof(DataT) * CHAR_BITS };
+            //No GPIO clock gating, see trio_clock_gating.hpp
+            typedef NullRegister ClockEnableReg;
+            static const uint32_t ClockEnableMask = 0;
+
+            //Register word offsets
+            enum
+            {
+                //SIO
+                GPIO_IN = 0x04 / 4,
+                GPIO_OUT = 0x10 / 4,
+                GPIO_OUT_SET = 0x14 / 4,
+                GPIO_OUT_CLR = 0x18 / 4,
+                GPIO_OUT_XOR = 0x1c / 4,
+                GPIO_OE = 0x20 / 4,
+                GPIO_OE_SET = 0x24 / 4,
+                GPIO_OE_CLR = 0x28 / 4,
+                GPIO_OE_XOR = 0x2c / 4,
+                //IO_BANK0
+                GPIO0_CTRL = 0x004 / 4,     //8 bytes per GPIO
+                PROC0_INTE0 = 0x100 / 4,    //4 bits per GPIO, 8 GPIOs per register
+                //PADS_BANK0
+                GPIO0_PAD = 0x04 / 4,
+                //Atomic register access aliases of APB peripherals
+                ALIAS_SET = 0x2000 / 4,
+                ALIAS_CLR = 0x3000 / 4
+            };
+
+            //Pad control bits
+            enum
+            {
+                PAD_SLEWFAST = 1 << 0,
+                PAD_SCHMITT = 1 << 1,
+                PAD_PDE = 1 << 2,
+                PAD_PUE = 1 << 3,
+                PAD_DRIVE_2MA = 0 << 4,
+                PAD_DRIVE_4MA = 1 << 4,
+                PAD_DRIVE_8MA = 2 << 4,
+                PAD_DRIVE_12MA = 3 << 4,
+                PAD_DRIVE_MASK = 3 << 4,
+                PAD_IE = 1 << 6,
+                PAD_OD = 1 << 7
+            };
+            enum{ FuncSio = 5, FuncNull = 31 };
+            //PROC0_INTE bits of one GPIO
+            enum{ IntEdgeLow = 1 << 2, IntEdgeHigh = 1 << 3 };
+        };//struct NativePortBase
+
+        template< class T >
+    	class PortImplimentation: public NativePortBase
+        {
+            static volatile uint32_t *Sio(){ return reinterpret_cast<volatile uint32_t *>( TRIO_RP2040_SIO_BASE ); }
+            static volatile uint32_t *IoBank(){ return reinterpret_cast<volatile uint32_t *>( TRIO_RP2040_IO_BANK0_BASE ); }
+            static volatile uint32_t *Pads(){ return reinterpret_cast<volatile uint32_t *>( TRIO_RP2040_PADS_BANK0_BASE ); }
+
+            //Pad settings of all pins in mask: bits in clearBits are cleared, then bits in setBits are set
+            static void WritePads(DataT mask, uint32_t clearBits, uint32_t setBits)
+            {
+                volatile uint32_t *pads = Pads();
+                for( uint8_t pin = 0; mask; ++pin, mask >>= 1 )
+                    if( mask & 1 )
+                    {
+                        pads[ALIAS_CLR + GPIO0_PAD + pin] = clearBits;
+                        pads[ALIAS_SET + GPIO0_PAD + pin] = setBits;
+                    }
+            }
+            static void WriteFunction(DataT mask, uint32_t func)
+            {
+                volatile uint32_t *io = IoBank();
+                for( uint8_t pin = 0; mask; ++pin, mask >>= 1 )
+                    if( mask & 1 )
+                        io[GPIO0_CTRL + pin * 2] = func;    //FUNCSEL, no overrides
+            }
+            //Edge interrupt enable bits for PROC0. set - enable or disable
+            static void WriteInterrupts(DataT mask, bool set)
+            {
+                volatile uint32_t *io = IoBank() + (set ? ALIAS_SET : ALIAS_CLR);
+                for( uint8_t reg = 0; reg < 4; ++reg )
+                {
+                    uint32_t bits = 0;
+                    for( uint8_t pin = 0; pin < 8; ++pin )
+                        if( mask & ((DataT)1 << (reg * 8 + pin)) )
+                            bits |= (uint32_t)(IntEdgeLow | IntEdgeHigh) << (pin * 4);
+                    if( bits )
+                        io[PROC0_INTE0 + reg] = bits;
+                }
+            }
+            static void Output(DataT mask, uint32_t drive)
+            {
+                WritePads( mask, PAD_OD | PAD_PUE | PAD_PDE | PAD_DRIVE_MASK | PAD_SLEWFAST, PAD_IE | drive );
+                WriteFunction( mask, FuncSio );
+                Sio()[GPIO_OE_SET] = mask;
+            }
+            static void Input(DataT mask, uint32_t pull)
+            {
+                Sio()[GPIO_OE_CLR] = mask;
+                WritePads( mask, PAD_OD | PAD_PUE | PAD_PDE, PAD_IE | pull );
+                WriteFunction( mask, FuncSio );
+            }
+        public:
+            //=============Generic API. Everybody should implement and respect it==============
+    		static void Write(DataT value){ Sio()[GPIO_OUT] = value; }	    //Write to GPIO output register
+            static DataT Read(){ return Sio()[GPIO_IN]; }			        //Read GPIO input register
+			static DataT ReadOutReg(){ return Sio()[GPIO_OUT]; }	        //Read GPIO output register
+            static void Set(DataT value){ Sio()[GPIO_OUT_SET] = value; }
+    		static void Clear(DataT value){ Sio()[GPIO_OUT_CLR] = value; }
+            static void ClearAndSet(DataT clearMask, DataT value){ Sio()[GPIO_OUT_CLR] = clearMask & ~value; Sio()[GPIO_OUT_SET] = value; }
+    		static void Toggle(DataT value){ Sio()[GPIO_OUT_XOR] = value; }
+
+            template<DataT value>
+    		static void Set(){ Set(value); }
+    		template<DataT value>
+    		static void Clear(){ Clear(value); }
+            template<DataT clearMask, DataT value>
+    		static void ClearAndSet(){ ClearAndSet(clearMask, value); }
+            template<DataT value>
+    		static void Toggle(){ Toggle(value); }
+
+            //Read only pins in MASK. Ports may read single pin faster
+            template<DataT MASK>
+            static DataT Read(){ return (DataT)(Read() & MASK); }
+
+            struct Configure
+            {
+                template<DataT MASK>
+                static void OutPushPull_Slow(){ Output( MASK, PAD_DRIVE_2MA ); }
+                template<DataT MASK>
+                static void OutPushPull_Medium(){ Output( MASK, PAD_DRIVE_4MA ); }
+                template<DataT MASK>
+                static void OutPushPull_Fast(){ Output( MASK, PAD_DRIVE_12MA | PAD_SLEWFAST ); }
+                template<DataT MASK>
+                static void OutOpenDrain_Slow(){ }      //Open Drain is not supported by RP2040 pads
+                template<DataT MASK>
+                static void OutOpenDrain_Medium(){ }    //Open Drain is not supported by RP2040 pads
+                template<DataT MASK>
+                static void OutOpenDrain_Fast(){ }      //Open Drain is not supported by RP2040 pads
+
+                template<DataT MASK>
+                static void InFloating(){ Input( MASK, 0 ); }
+                template<DataT MASK>
+                static void InPullUp(){ Input( MASK, PAD_PUE ); }
+                template<DataT MASK>
+                static void InPullDown(){ Input( MASK, PAD_PDE ); }
+                //Input buffer off, output disabled(same as ADC pin setup in SDK)
+                template<DataT MASK>
+                static void InAnalog()
+                {
+                    Sio()[GPIO_OE_CLR] = MASK;
+                    WritePads( MASK, PAD_IE | PAD_PUE | PAD_PDE, PAD_OD );
+                    WriteFunction( MASK, FuncNull );
+                }
+
+                //There is no single AF in RP2040. Use HWSpecificAPI::SetFunction
+                template<DataT MASK>
+                static void EnableAF(){ }
+                template<DataT MASK>
+                static void DisableAF(){ WriteFunction( MASK, FuncSio ); }
+                //Both edges interrupt for PROC0(IO_IRQ_BANK0)
+                template<DataT MASK>
+                static void EnableInterrupt(){ WriteInterrupts( MASK, true ); }
+                template<DataT MASK>
+                static void DisableInterrupt(){ WriteInterrupts( MASK, false ); }
+
+                //Same configurations with runtime mask
+                static void OutPushPull_Slow(DataT mask){ Output( mask, PAD_DRIVE_2MA ); }
+                static void OutPushPull_Medium(DataT mask){ Output( mask, PAD_DRIVE_4MA ); }
+                static void OutPushPull_Fast(DataT mask){ Output( mask, PAD_DRIVE_12MA | PAD_SLEWFAST ); }
+                static void OutOpenDrain_Slow(DataT mask){ }
+                static void OutOpenDrain_Medium(DataT mask){ }
+                static void OutOpenDrain_Fast(DataT mask){ }
+
+                static void InFloating(DataT mask){ Input( mask, 0 ); }
+                static void InPullUp(DataT mask){ Input( mask, PAD_PUE ); }
+                static void InPullDown(DataT mask){ Input( mask, PAD_PDE ); }
+                static void InAnalog(DataT mask)
+                {
+                    Sio()[GPIO_OE_CLR] = mask;
+                    WritePads( mask, PAD_IE | PAD_PUE | PAD_PDE, PAD_OD );
+                    WriteFunction( mask, FuncNull );
+                }
+
+                static void EnableAF(DataT mask){ }
+                static void DisableAF(DataT mask){ WriteFunction( mask, FuncSio ); }
+                static void EnableInterrupt(DataT mask){ WriteInterrupts( mask, true ); }
+                static void DisableInterrupt(DataT mask){ WriteInterrupts( mask, false ); }
+            };
+
+            //=============Hardware specific API for maximum flexibility======================
+            //TPin will expose this API to users as Pxn::HWSpecificAPI::HWSpecific_method();
+            //Some operations may need MASK to work, TPin will provide it.
+            template< DataT MASK=0 >
+            struct HWSpecificAPI
+            {
+                //FUNCSEL value from datasheet(1 - SPI, 2 - UART, 3 - I2C, 4 - PWM, 5 - SIO, 6,7 - PIO, 9 - USB)
+                template< uint32_t FUNC >
+                static void SetFunction(){ WriteFunction( MASK, FUNC ); }
+                //Direction change without pad and function setup
+                static void OutputEnable(){ Sio()[GPIO_OE_SET] = MASK; }
+                static void OutputDisable(){ Sio()[GPIO_OE_CLR] = MASK; }
+                static void OutputToggle(){ Sio()[GPIO_OE_XOR] = MASK; }
+                static volatile uint32_t *GetSIORegs(){ return Sio(); }
+            };
+    	};//PortImplimentation
+    }//namespace Private
+
+#define MAKE_PORT(className, ID) \
+        class className :public Private::PortImplimentation<className>{\
+            friend class Private::PortImplimentation<className>;\
+            public:\
+            enum{Id = ID};\
+        };
+
+	#define TRIO_HAS_PORTA
+    MAKE_PORT(Porta, 'A')   //GPIO0..GPIO29
+}//namespace TRIO
+#endif /*TRIO_GPIO_IMPLEMENTATION_HPP_RP2040_*/
@@ -0,0 +1,75 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#ifndef TRIO_PINS_DECLARATION_HPP_
+#define TRIO_PINS_DECLARATION_HPP_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+#ifndef TRIO_RP2040_PORT_
+	#error "This file related to RP2040 port! /RP2040/trio_gpio_implementation.hpp should define TRIO_RP2040_PORT_ macro"
+#endif 
+
+namespace TRIO
+{
+	#ifdef TRIO_HAS_PORTA	//GPIO0..GPIO29
+		TRIO_DEFINE_PA0()
+		TRIO_DEFINE_PA1()
+		TRIO_DEFINE_PA2()
+		TRIO_DEFINE_PA3()
+		TRIO_DEFINE_PA4()
+		TRIO_DEFINE_PA5()
+		TRIO_DEFINE_PA6()
+		TRIO_DEFINE_PA7()
+		TRIO_DEFINE_PA8()
+		TRIO_DEFINE_PA9()
+		TRIO_DEFINE_PA10()
+		TRIO_DEFINE_PA11()
+		TRIO_DEFINE_PA12()
+		TRIO_DEFINE_PA13()
+		TRIO_DEFINE_PA14()
+		TRIO_DEFINE_PA15()
+		TRIO_DEFINE_PA16()
+		TRIO_DEFINE_PA17()
+		TRIO_DEFINE_PA18()
+		TRIO_DEFINE_PA19()
+		TRIO_DEFINE_PA20()
+		TRIO_DEFINE_PA21()
+		TRIO_DEFINE_PA22()
+		TRIO_DEFINE_PA23()
+		TRIO_DEFINE_PA24()
+		TRIO_DEFINE_PA25()
+		TRIO_DEFINE_PA26()
+		TRIO_DEFINE_PA27()
+		TRIO_DEFINE_PA28()
+		TRIO_DEFINE_PA29()
+	#endif
+
+}//namespace TRIO
+
+#endif /*TRIO_PINS_DECLARATION_HPP_*/
@@ -0,0 +1,428 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: apr 2017
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#ifndef TRIO_GPIO_IMPLEMENTATION_HPP_STM32_
+#define TRIO_GPIO_IMPLEMENTATION_HPP_STM32_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+/*STM32 ports with MODER/OTYPER/OSPEEDR/PUPDR/BSRR registers (F0, F2, F3, F4, F7, L0, L1, L4, G0, G4...)
+* STM32F1 has different GPIO module(CRL/CRH), see STM32F1 directory.
+* GPIO_TypeDef and GPIOA, GPIOB... are taken from CMSIS device header, include it before trio.hpp
+*
+* Set/Clear/ClearAndSet/Toggle are done with one BSRR write, so they are atomic.
+* Configure methods do one masked write per MODER/OTYPER/OSPEEDR/PUPDR register
+* protected according to TRIO_RMW_POLICY (see trio_atomic.hpp) */
+
+//define to know on what MCU we are running
+//#define TRIO_STM8_PORT_
+#define TRIO_STM32_PORT_
+#define TRIO_STM32_HAS_AFR      //AF numbers are selected by AFRL/AFRH, see trio_stm32_af.hpp
+//#define TRIO_AVR_PORT_
+//#define TRIO_XMEGA_PORT_
+
+/*Bit-band(Cortex-M3/M4 only, opt-in)
+* #define TRIO_STM32_USE_BITBAND 1
+* Then compile time single pin Read(TPin::IsSet) and Toggle are one load/store of IDR/ODR bit-band alias word.
+* Set/Clear are one BSRR store anyway. Port address is checked at compile time, see trio_cortexm_bitband.hpp*/
+#ifndef TRIO_STM32_USE_BITBAND
+    #define TRIO_STM32_USE_BITBAND 0
+#endif
+#if TRIO_STM32_USE_BITBAND
+    #if defined(__CORTEX_M) && (__CORTEX_M != 3) && (__CORTEX_M != 4)
+        #error "Bit-band is supported by Cortex-M3 and Cortex-M4 only"
+    #endif
+    #include "trio_cortexm_bitband.hpp"
+#endif
+
+/*GPIO clock enable register is detected by CMSIS RCC bit names:
+* RCC->AHB1ENR(F2, F4, F7), RCC->AHBENR(F0, F3, L1), RCC->AHB2ENR(L4, L5, G4, U5), RCC->IOPENR(L0, G0), RCC->AHB4ENR(H7)
+* Enable bit of every port is taken by name(RCC_AHB1ENR_GPIOAEN...), so it works for not contiguous bits too.
+* Ports get ClockEnableReg and ClockEnableMask, see trio_clock_gating.hpp. Unknown family - no clock gating*/
+#if defined(RCC_AHB1ENR_GPIOAEN)
+    #define TRIO_STM32_GPIO_CLOCK_REG               AHB1ENR
+    #define TRIO_STM32_GPIO_CLOCK_BIT(GPIOxEN)      RCC_AHB1ENR_ ## GPIOxEN
+#elif defined(RCC_AHBENR_GPIOAEN)
+    #define TRIO_STM32_GPIO_CLOCK_REG               AHBENR
+    #define TRIO_STM32_GPIO_CLOCK_BIT(GPIOxEN)      RCC_AHBENR_ ## GPIOxEN
+#elif defined(RCC_AHB2ENR_GPIOAEN)
+    #define TRIO_STM32_GPIO_CLOCK_REG               AHB2ENR
+    #define TRIO_STM32_GPIO_CLOCK_BIT(GPIOxEN)      RCC_AHB2ENR_ ## GPIOxEN
+#elif defined(RCC_IOPENR_GPIOAEN)
+    #define TRIO_STM32_GPIO_CLOCK_REG               IOPENR
+    #define TRIO_STM32_GPIO_CLOCK_BIT(GPIOxEN)      RCC_IOPENR_ ## GPIOxEN
+#elif defined(RCC_AHB4ENR_GPIOAEN)
+    #define TRIO_STM32_GPIO_CLOCK_REG               AHB4ENR
+    #define TRIO_STM32_GPIO_CLOCK_BIT(GPIOxEN)      RCC_AHB4ENR_ ## GPIOxEN
+#endif
+
+namespace TRIO
+{
+    namespace Private
+    {
+        /*Spread 16 bit pin mask to 32 bit mask with 2 bits per pin: pin N -> bit 2*N*/
+        template< uint16_t MASK >
+        class SpreadMaskBy2
+        {
+            static const uint32_t x0 = MASK;
+            static const uint32_t x1 = (x0 | (x0 << 8)) & 0x00FF00FFUL;
+            static const uint32_t x2 = (x1 | (x1 << 4)) & 0x0F0F0F0FUL;
+            static const uint32_t x3 = (x2 | (x2 << 2)) & 0x33333333UL;
+        public:
+            static const uint32_t value = (x3 | (x3 << 1)) & 0x55555555UL;
+        };
+        //Same for runtime mask
+        inline uint32_t SpreadBy2(uint32_t x)
+        {
+            x = (x | (x << 8)) & 0x00FF00FFUL;
+            x = (x | (x << 4)) & 0x0F0F0F0FUL;
+            x = (x | (x << 2)) & 0x33333333UL;
+            return (x | (x << 1)) & 0x55555555UL;
+        }
+
+        /*Spread 8 bit pin mask to 32 bit mask with 4 bits per pin(AFRL, AFRH): pin N -> bit 4*N*/
+        template< uint8_t MASK >
+        class SpreadMaskBy4
+        {
+            static const uint32_t x0 = MASK;
+            static const uint32_t x1 = (x0 | (x0 << 12)) & 0x000F000FUL;
+            static const uint32_t x2 = (x1 | (x1 << 6)) & 0x03030303UL;
+        public:
+            static const uint32_t value = (x2 | (x2 << 3)) & 0x11111111UL;
+        };
+
+        /*Masks for 2 bit per pin configuration registers(MODER, OSPEEDR, PUPDR)
+        * MASK - pins to configure, CONF - 2 bit configuration value
+        * CLEAR_MASK has both bits set for every pin in MASK, SET_MASK has CONF for every pin in MASK*/
+        template< uint16_t MASK, uint32_t CONF >
+        struct ConfigMasksMaker
+        {
+            static const uint32_t CLEAR_MASK = SpreadMaskBy2<MASK>::value * 3UL;
+            static const uint32_t SET_MASK = SpreadMaskBy2<MASK>::value * CONF;
+        };
+
+        struct NativePortBase
+        {
+            typedef uint16_t DataT;
+            enum{ Width = sizeof(DataT) * CHAR_BITS };
+            //No GPIO clock gating by default. Ports override it if RCC register is known, see MAKE_PORT
+            typedef NullRegister ClockEnableReg;
+            static const uint32_t ClockEnableMask = 0;
+
+            //MODER values
+            enum{ ModeInput = 0, ModeOutput = 1, ModeAF = 2, ModeAnalog = 3 };
+            //OSPEEDR values. 11 is highest speed on every family.
+            enum{ SpeedLow = 0, SpeedMedium = 1, SpeedHigh = 3 };
+            //PUPDR values
+            enum{ PullNone = 0, PullUp = 1, PullDown = 2 };
+        };//struct NativePortBase
+
+        template< class T >
+    	class PortImplimentation: public NativePortBase
+        {
+            //Helper classes to acces GPIO registers nice and easy
+            IO_REG_WRAPPER(T::GetPortStuct().MODER,     MODER,      uint32_t);//GPIO port mode register                 [0x00]
+            IO_REG_WRAPPER(T::GetPortStuct().OTYPER,    OTYPER,     uint32_t);//GPIO port output type register          [0x04]
+            IO_REG_WRAPPER(T::GetPortStuct().OSPEEDR,   OSPEEDR,    uint32_t);//GPIO port output speed register         [0x08]
+            IO_REG_WRAPPER(T::GetPortStuct().PUPDR,     PUPDR,      uint32_t);//GPIO port pull-up/pull-down register    [0x0C]
+            IO_REG_WRAPPER(T::GetPortStuct().IDR,       IDR,        uint32_t);//GPIO port input data register           [0x10]
+            IO_REG_WRAPPER(T::GetPortStuct().ODR,       ODR,        uint32_t);//GPIO port output data register          [0x14]
+            IO_REG_WRAPPER(T::GetPortStuct().BSRR,      BSRR,       uint32_t);//GPIO port bit set/reset register        [0x18]
+            IO_REG_WRAPPER(T::GetPortStuct().AFR[0],    AFRL,       uint32_t);//GPIO alternate function low register    [0x20]
+            IO_REG_WRAPPER(T::GetPortStuct().AFR[1],    AFRH,       uint32_t);//GPIO alternate function high register   [0x24]
+
+            //One masked write of 2 bit per pin register
+            template< class REG, DataT MASK, uint32_t CONF >
+            static void Write2BitConfig()
+            {
+                typedef ConfigMasksMaker<MASK, CONF> Masks;
+                RmwPolicy::AndOr<REG, ~Masks::CLEAR_MASK, Masks::SET_MASK>();
+            }
+
+            template< DataT MASK, bool OPEN_DRAIN, uint32_t SPEED >
+            static void ConfigureOut()
+            {
+                RmwPolicy::AndOr<OTYPER, ~(uint32_t)MASK, OPEN_DRAIN ? MASK : 0>();
+                Write2BitConfig<OSPEEDR, MASK, SPEED>();
+                Write2BitConfig<PUPDR, MASK, PullNone>();
+                Write2BitConfig<MODER, MASK, ModeOutput>();
+            }
+
+            template< DataT MASK, uint32_t MODE, uint32_t PULL >
+            static void ConfigureIn()
+            {
+                Write2BitConfig<MODER, MASK, MODE>();
+                Write2BitConfig<PUPDR, MASK, PULL>();
+            }
+
+            //Same with runtime mask
+            template< class REG >
+            static void Write2BitConfig(DataT mask, uint32_t conf)
+            {
+                const uint32_t spread = SpreadBy2(mask);
+                RmwPolicy::AndOr<REG>( ~(spread * 3), spread * conf );
+            }
+            static void ConfigureOut(DataT mask, bool openDrain, uint32_t speed)
+            {
+                RmwPolicy::AndOr<OTYPER>( ~(uint32_t)mask, openDrain ? mask : 0 );
+                Write2BitConfig<OSPEEDR>( mask, speed );
+                Write2BitConfig<PUPDR>( mask, PullNone );
+                Write2BitConfig<MODER>( mask, ModeOutput );
+            }
+            static void ConfigureIn(DataT mask, uint32_t mode, uint32_t pull)
+            {
+                Write2BitConfig<MODER>( mask, mode );
+                Write2BitConfig<PUPDR>( mask, pull );
+            }
+
+            /*AFRL/AFRH values have 4 bits per pin. Only registers with MASK pins are written.
+            * AF numbers are written before MODER, so pin doesn't go through wrong AF*/
+            template< DataT MASK, uint32_t AFRL_VALUE, uint32_t AFRH_VALUE >
+            static void ConfigureAF()
+            {
+                if( (uint8_t)MASK )
+                    RmwPolicy::AndOr<AFRL, (uint32_t)~(SpreadMaskBy4<(uint8_t)MASK>::value * 0xF), AFRL_VALUE>();
+                if( (uint8_t)(MASK >> 8) )
+                    RmwPolicy::AndOr<AFRH, (uint32_t)~(SpreadMaskBy4<(uint8_t)(MASK >> 8)>::value * 0xF), AFRH_VALUE>();
+                Write2BitConfig<MODER, MASK, ModeAF>();
+            }
+        #if TRIO_STM32_USE_BITBAND
+            //Single pin Read and Toggle through bit-band aliases of IDR and ODR
+            template< DataT MASK, bool SINGLE_PIN = (MASK != 0 && (MASK & (MASK - 1)) == 0) >
+            struct PinOp
+            {
+                static DataT Read(){ return (DataT)(IDR::Value() & MASK); }
+                static void Toggle(){ PortImplimentation::Toggle(MASK); }
+            };
+            template< DataT MASK >
+            struct PinOp< MASK, true >
+            {
+                typedef BitBandAlias< T::BaseAddress + 0x10, BitNumberOfMask<MASK>::value > IdrBit;
+                typedef BitBandAlias< T::BaseAddress + 0x14, BitNumberOfMask<MASK>::value > OdrBit;
+                static DataT Read(){ return IdrBit::Reference() ? MASK : 0; }
+                static void Toggle(){ OdrBit::Reference() ^= 1; }   //other pins are not touched
+            };
+        #endif
+        public:
+            //=============Generic API. Everybody should implement and respect it==============
+    		static void Write(DataT value){ ODR::Set(value); }	//Write to GPIO output register
+            static DataT Read(){ return (DataT)IDR::Value(); }			//Read GPIO input register
+			static DataT ReadOutReg(){ return (DataT)ODR::Value(); }	//Read GPIO output register
+            //BSRR: low half sets pins, high half resets pins. Set wins if pin is in both halves.
+            static void Set(DataT value){ BSRR::Set(value); }
+    		static void Clear(DataT value){ BSRR::Set( (uint32_t)value << 16 ); }
+            static void ClearAndSet(DataT clearMask, DataT value){ BSRR::Set( ((uint32_t)clearMask << 16) | value ); }
+            //Only pins from value are written, so other pins of the port are safe even if ISR changes them
+    		static void Toggle(DataT value)
+            {
+                const uint32_t odr = ODR::Value();
+                BSRR::Set( ((odr & value) << 16) | (~odr & value) );
+            }
+
+            template<DataT value>
+    		static void Set(){ BSRR::Set(value); }
+    		template<DataT value>
+    		static void Clear(){ BSRR::Set( (uint32_t)value << 16 ); }
+            template<DataT clearMask, DataT value>
+    		static void ClearAndSet(){ BSRR::Set( ((uint32_t)clearMask << 16) | value ); }
+        #if TRIO_STM32_USE_BITBAND
+            template<DataT value>
+    		static void Toggle(){ PinOp<value>::Toggle(); }
+            template<DataT MASK>
+            static DataT Read(){ return PinOp<MASK>::Read(); }
+        #else
+            template<DataT value>
+    		static void Toggle(){ Toggle(value); }
+            //Read only pins in MASK
+            template<DataT MASK>
+            static DataT Read(){ return (DataT)(Read() & MASK); }
+        #endif
+
+            struct Configure
+            {
+                template<DataT MASK>
+                static void OutPushPull_Slow(){ ConfigureOut<MASK, false, SpeedLow>(); }
+                template<DataT MASK>
+                static void OutPushPull_Medium(){ ConfigureOut<MASK, false, SpeedMedium>(); }
+                template<DataT MASK>
+                static void OutPushPull_Fast(){ ConfigureOut<MASK, false, SpeedHigh>(); }
+                template<DataT MASK>
+                static void OutOpenDrain_Slow(){ ConfigureOut<MASK, true, SpeedLow>(); }
+                template<DataT MASK>
+                static void OutOpenDrain_Medium(){ ConfigureOut<MASK, true, SpeedMedium>(); }
+                template<DataT MASK>
+                static void OutOpenDrain_Fast(){ ConfigureOut<MASK, true, SpeedHigh>(); }
+
+                template<DataT MASK>
+                static void InFloating(){ ConfigureIn<MASK, ModeInput, PullNone>(); }
+                template<DataT MASK>
+                static void InPullUp(){ ConfigureIn<MASK, ModeInput, PullUp>(); }
+                template<DataT MASK>
+                static void InPullDown(){ ConfigureIn<MASK, ModeInput, PullDown>(); }
+                template<DataT MASK>
+                static void InAnalog(){ ConfigureIn<MASK, ModeAnalog, PullNone>(); }
+
+                //Output type and speed are kept. Select AF number with HWSpecificAPI::SetAF<AF>() or AlternateFunctions(trio_stm32_af.hpp)
+                template<DataT MASK>
+                static void EnableAF(){ Write2BitConfig<MODER, MASK, ModeAF>(); }
+                //Return pin to input, it doesn't drive the line(AF input like UART RX may be connected to other output).
+                //Configure pin as output with OutXXX if it should drive
+                template<DataT MASK>
+                static void DisableAF(){ Write2BitConfig<MODER, MASK, ModeInput>(); }
+                template<DataT MASK>
+                static void EnableInterrupt(){  } //Interrupt registers are in EXTI module, not in GPIO. So empty
+                template<DataT MASK>
+                static void DisableInterrupt(){  } //Interrupt registers are in EXTI module, not in GPIO. So empty
+
+                //Same configurations with runtime mask
+                static void OutPushPull_Slow(DataT mask){ ConfigureOut( mask, false, SpeedLow ); }
+                static void OutPushPull_Medium(DataT mask){ ConfigureOut( mask, false, SpeedMedium ); }
+                static void OutPushPull_Fast(DataT mask){ ConfigureOut( mask, false, SpeedHigh ); }
+                static void OutOpenDrain_Slow(DataT mask){ ConfigureOut( mask, true, SpeedLow ); }
+                static void OutOpenDrain_Medium(DataT mask){ ConfigureOut( mask, true, SpeedMedium ); }
+                static void OutOpenDrain_Fast(DataT mask){ ConfigureOut( mask, true, SpeedHigh ); }
+
+                static void InFloating(DataT mask){ ConfigureIn( mask, ModeInput, PullNone ); }
+                static void InPullUp(DataT mask){ ConfigureIn( mask, ModeInput, PullUp ); }
+                static void InPullDown(DataT mask){ ConfigureIn( mask, ModeInput, PullDown ); }
+                static void InAnalog(DataT mask){ ConfigureIn( mask, ModeAnalog, PullNone ); }
+
+                static void EnableAF(DataT mask){ Write2BitConfig<MODER>( mask, ModeAF ); }
+                static void DisableAF(DataT mask){ Write2BitConfig<MODER>( mask, ModeInput ); }
+                static void EnableInterrupt(DataT mask){ }
+                static void DisableInterrupt(DataT mask){ }
+            };
+
+            //=============Hardware specific API for maximum flexibility======================
+            //TPin will expose this API to users as Pxn::HWSpecificAPI::HWSpecific_method();
+            //Some operations may need MASK to work, TPin will provide it.
+            template< DataT MASK=0 >
+            struct HWSpecificAPI
+            {
+                //Select alternate function AF for MASK pins and switch them to AF mode: Pa9::HWSpecificAPI::SetAF<7>();
+                template< uint8_t AF >
+                static void SetAF()
+                {
+                    BOOST_STATIC_ASSERT( AF < 16 );
+                    ConfigureAF< MASK, SpreadMaskBy4<(uint8_t)MASK>::value * AF, SpreadMaskBy4<(uint8_t)(MASK >> 8)>::value * AF >();
+                }
+                //Different AF numbers for MASK pins, given as AFRL/AFRH values. See trio_stm32_af.hpp
+                template< uint32_t AFRL_VALUE, uint32_t AFRH_VALUE >
+                static void WriteAF(){ ConfigureAF<MASK, AFRL_VALUE, AFRH_VALUE>(); }
+
+                static GPIO_TypeDef &GetGPIORegsReference(){ return T::GetPortStuct(); }
+            };
+    	};//PortImplimentation
+
+    #if defined(TRIO_STM32_GPIO_CLOCK_REG)
+        IO_REG_WRAPPER(RCC->TRIO_STM32_GPIO_CLOCK_REG, GpioClockEnableReg, uint32_t);
+    #endif
+    }//namespace Private
+
+#if defined(TRIO_STM32_GPIO_CLOCK_REG)
+    #define TRIO_STM32_PORT_CLOCK(GPIOxEN) \
+            typedef Private::GpioClockEnableReg ClockEnableReg;\
+            static const uint32_t ClockEnableMask = TRIO_STM32_GPIO_CLOCK_BIT(GPIOxEN);
+#else
+    #define TRIO_STM32_PORT_CLOCK(GPIOxEN)
+#endif
+
+
+//Port base address is needed only for bit-band aliases, so GPIOx_BASE is not required without bit-band
+#if TRIO_STM32_USE_BITBAND
+    #define TRIO_STM32_PORT_BASE(GPIOx_BASE) static const uint32_t BaseAddress = GPIOx_BASE;
+#else
+    #define TRIO_STM32_PORT_BASE(GPIOx_BASE)
+#endif
+
+#define MAKE_PORT(portName, className, ID) \
+        class className :public Private::PortImplimentation<className>{\
+            static GPIO_TypeDef &GetPortStuct(){ return *portName; }\
+            TRIO_STM32_PORT_BASE(portName ## _BASE)\
+            friend class Private::PortImplimentation<className>;\
+            public:\
+            enum{Id = ID};\
+            TRIO_STM32_PORT_CLOCK(portName ## EN)\
+        };
+
+#ifdef GPIOA
+	#define TRIO_HAS_PORTA
+    MAKE_PORT(GPIOA, Porta, 'A')
+#endif
+
+#ifdef GPIOB
+	#define TRIO_HAS_PORTB
+    MAKE_PORT(GPIOB, Portb, 'B')
+#endif
+
+#ifdef GPIOC
+	#define TRIO_HAS_PORTC
+    MAKE_PORT(GPIOC, Portc, 'C')
+#endif
+
+#ifdef GPIOD
+	#define TRIO_HAS_PORTD
+    MAKE_PORT(GPIOD, Portd, 'D')
+#endif
+
+#ifdef GPIOE
+	#define TRIO_HAS_PORTE
+    MAKE_PORT(GPIOE, Porte, 'E')
+#endif
+
+#ifdef GPIOF
+	#define TRIO_HAS_PORTF
+    MAKE_PORT(GPIOF, Portf, 'F')
+#endif
+
+#ifdef GPIOG
+	#define TRIO_HAS_PORTG
+    MAKE_PORT(GPIOG, Portg, 'G')
+#endif
+
+#ifdef GPIOH
+	#define TRIO_HAS_PORTH
+    MAKE_PORT(GPIOH, Porth, 'H')
+#endif
+
+#ifdef GPIOI
+	#define TRIO_HAS_PORTI
+    MAKE_PORT(GPIOI, Porti, 'I')
+#endif
+
+#ifdef GPIOJ
+	#define TRIO_HAS_PORTJ
+    MAKE_PORT(GPIOJ, Portj, 'J')
+#endif
+
+#ifdef GPIOK
+	#define TRIO_HAS_PORTK
+    MAKE_PORT(GPIOK, Portk, 'K')
+#endif
+}//namespace TRIO
+#endif /*TRIO_GPIO_IMPLEMENTATION_HPP_STM32_*/
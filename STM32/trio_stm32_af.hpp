@@ -0,0 +1,145 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#ifndef TRIO_STM32_AF_HPP_STM32_
+#define TRIO_STM32_AF_HPP_STM32_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+#ifndef TRIO_STM32_HAS_AFR
+	#error "This file related to STM32 port! /STM32/trio_gpio_implementation.hpp should define TRIO_STM32_HAS_AFR macro"
+#endif
+
+/*Alternate function routing of many pins at once
+*
+* Every pin gets its own AF number. List of (pin, AF) pairs is grouped by port at compile time,
+* then each port gets at most one masked write to AFRL, one to AFRH and one to MODER(in this order).
+* Output type, speed and pulls are kept, configure them as usual.
+*
+* typedef AlternateFunctions<
+*     PinAF<Pa9, 7>, PinAF<Pa10, 7>,        //USART1
+*     PinAF<Pb6, 4>, PinAF<Pb7, 4>,         //I2C1
+*     PinAF<Pa5, 5>, PinAF<Pa6, 5>, PinAF<Pa7, 5> //SPI1
+* > BoardAF;
+* BoardAF::Apply();     //2 ports: AFRL + AFRH + MODER of port A, AFRL + MODER of port B
+*
+* Single pin or same AF for several pins: Pa9::HWSpecificAPI::SetAF<7>();*/
+
+#include <stdint.h>
+#include "loki/Typelist.h"
+#include "loki/TypeManip.h"
+#include "boost_static_assert.h"
+
+namespace TRIO
+{
+    //PIN - TPin or InvertedPin, AF - alternate function number 0..15 from datasheet
+    template< class PIN, uint8_t AF >
+    struct PinAF
+    {
+        BOOST_STATIC_ASSERT( AF < 16 );
+        typedef typename PIN::TRIOInternals::Port Port;
+        static const uint8_t PortPinNumber = PIN::TRIOInternals::PortPinNumber;
+        static const uint8_t Af = AF;
+    };
+
+    namespace Private
+    {
+        template< class T, class U, uint32_t N >
+        struct mfGetPinAFPort
+        {
+            typedef typename T::Port Result;
+        };
+
+        //PinAF T belongs to port U
+        template< class T, class U, uint32_t N >
+        struct IfPinAFBelongsToPort{ enum{ value = Loki::IsSameType<typename T::Port, U>::value }; };
+
+        template< class T, class U, uint32_t N >
+        struct mfPinAFPortMask
+        {
+            typedef uint32_t RetvalType;
+            static const uint32_t value = 1UL << T::PortPinNumber;
+        };
+
+        //AF number in AFRL(N=0) or AFRH(N=1) position
+        template< class T, class U, uint32_t N >
+        struct mfPinAFRegValue
+        {
+            typedef uint32_t RetvalType;
+            static const uint32_t value = (T::PortPinNumber / 8 == N) ? (uint32_t)T::Af << ((T::PortPinNumber % 8) * 4) : 0;
+        };
+
+        /*T Port
+        * U List of PinAF
+        * One ConfigureAF of the port for all its pins*/
+        template< class T, class U, uint32_t N, uint32_t M >
+        class rfWritePortAF
+        {
+            typedef typename Utils::CopyIf<U, IfPinAFBelongsToPort, T>::Result     PinsOfThisPort;
+            static const typename T::DataT MASK = Utils::metaForEach_bitOr<PinsOfThisPort, mfPinAFPortMask>::value;
+            static const uint32_t AFRL_VALUE = Utils::metaForEach_bitOr<PinsOfThisPort, mfPinAFRegValue, Loki::NullType, 0>::value;
+            static const uint32_t AFRH_VALUE = Utils::metaForEach_bitOr<PinsOfThisPort, mfPinAFRegValue, Loki::NullType, 1>::value;
+            //Same pin twice in the list
+            BOOST_STATIC_ASSERT( Utils::PopBits<MASK>::value == Loki::TL::Length<PinsOfThisPort>::value );
+        public:
+            static void Run(){ T::template HWSpecificAPI<MASK>::template WriteAF<AFRL_VALUE, AFRH_VALUE>(); }
+        };
+
+        template< class PINAFLIST >
+        class AlternateFunctionsImplementation
+        {
+            typedef typename Loki::TL::NoDuplicates< typename Utils::metaForEach_TList<PINAFLIST, mfGetPinAFPort>::Result >::Result Ports;
+        public:
+            static void Apply(){ Utils::runForEach<Ports, rfWritePortAF, PINAFLIST>::Run(); }
+        };
+    }//namespace Private
+
+    //T1...T32 - PinAF<Pxn, AF>
+    template<
+        typename T1  = Loki::NullType, typename T2  = Loki::NullType, typename T3  = Loki::NullType,
+        typename T4  = Loki::NullType, typename T5  = Loki::NullType, typename T6  = Loki::NullType,
+        typename T7  = Loki::NullType, typename T8  = Loki::NullType, typename T9  = Loki::NullType,
+        typename T10 = Loki::NullType, typename T11 = Loki::NullType, typename T12 = Loki::NullType,
+        typename T13 = Loki::NullType, typename T14 = Loki::NullType, typename T15 = Loki::NullType,
+        typename T16 = Loki::NullType, typename T17 = Loki::NullType, typename T18 = Loki::NullType,
+        typename T19 = Loki::NullType, typename T20 = Loki::NullType, typename T21 = Loki::NullType,
+        typename T22 = Loki::NullType, typename T23 = Loki::NullType, typename T24 = Loki::NullType,
+        typename T25 = Loki::NullType, typename T26 = Loki::NullType, typename T27 = Loki::NullType,
+        typename T28 = Loki::NullType, typename T29 = Loki::NullType, typename T30 = Loki::NullType,
+        typename T31 = Loki::NullType, typename T32 = Loki::NullType
+    >
+    class AlternateFunctions: public Private::AlternateFunctionsImplementation<
+                    typename Loki::TL::Append<
+                        typename Loki::TL::MakeTypelist<T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16>::Result,
+                        typename Loki::TL::MakeTypelist<T17,T18,T19,T20,T21,T22,T23,T24,T25,T26,T27,T28,T29,T30,T31,T32>::Result
+                    >::Result >
+    {
+    };
+}//namespace TRIO
+
+#endif//TRIO_STM32_AF_HPP_STM32_
@@ -0,0 +1,347 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: apr 2017
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#ifndef TRIO_GPIO_IMPLEMENTATION_HPP_STM32F1_
+#define TRIO_GPIO_IMPLEMENTATION_HPP_STM32F1_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+/*STM32F1 ports with CRL/CRH configuration registers(4 bits per pin: CNF[1:0] MODE[1:0])
+* Other STM32 families with MODER register are in STM32 directory.
+* GPIO_TypeDef, RCC and GPIOA, GPIOB... are taken from CMSIS device header, include it before trio.hpp
+*
+* Set/Clear/ClearAndSet/Toggle are done with one BSRR write, so they are atomic.
+* Configure writes only CRL if all pins are 0..7 and only CRH if all pins are 8..15.
+* CRL/CRH writes are protected according to TRIO_RMW_POLICY (see trio_atomic.hpp) */
+
+//define to know on what MCU we are running
+//#define TRIO_STM8_PORT_
+#define TRIO_STM32_PORT_
+//#define TRIO_AVR_PORT_
+//#define TRIO_XMEGA_PORT_
+
+/*Bit-band(Cortex-M3/M4 only, opt-in)
+* #define TRIO_STM32_USE_BITBAND 1
+* Then compile time single pin Read(TPin::IsSet) and Toggle are one load/store of IDR/ODR bit-band alias word.
+* Set/Clear are one BSRR store anyway. Port address is checked at compile time, see trio_cortexm_bitband.hpp*/
+#ifndef TRIO_STM32_USE_BITBAND
+    #define TRIO_STM32_USE_BITBAND 0
+#endif
+#if TRIO_STM32_USE_BITBAND
+    #if defined(__CORTEX_M) && (__CORTEX_M != 3) && (__CORTEX_M != 4)
+        #error "Bit-band is supported by Cortex-M3 and Cortex-M4 only"
+    #endif
+    #include "trio_cortexm_bitband.hpp"
+#endif
+
+namespace TRIO
+{
+    namespace Private
+    {
+        //All GPIO clocks are in one register, see trio_clock_gating.hpp
+        IO_REG_WRAPPER(RCC->APB2ENR, RccApb2Enr, uint32_t);
+
+        /*Spread 8 bit pin mask to 32 bit mask with 4 bits per pin: pin N -> bit 4*N
+        * Multiply by configuration nibble to get value for CRL/CRH*/
+        template< uint32_t MASK >
+		class ConfigurationMask
+		{
+			static const uint32_t mask1 = (MASK & 0xf0) << 12 | (MASK & 0x0f);
+			static const uint32_t mask2 = (mask1 & 0x000C000C) << 6 | (mask1 & 0x00030003);
+			static const uint32_t mask3 = (mask2 & 0x02020202) << 3 | (mask2 & 0x01010101);
+		public:
+			static const uint32_t value = mask3;
+		};
+        //Same for runtime mask
+        inline uint32_t SpreadConfigurationMask(uint32_t mask)
+        {
+            const uint32_t mask1 = (mask & 0xf0) << 12 | (mask & 0x0f);
+            const uint32_t mask2 = (mask1 & 0x000C000C) << 6 | (mask1 & 0x00030003);
+            return (mask2 & 0x02020202) << 3 | (mask2 & 0x01010101);
+        }
+
+        struct NativePortBase
+        {
+            typedef uint16_t DataT;
+            enum{ Width = sizeof(DataT) * CHAR_BITS };
+
+            //CRL/CRH configuration nibbles
+            enum
+            {
+                AnalogIn = 0x00,
+                In = 0x04,
+                PullUpOrDownIn = 0x08,
+                Out10Mhz = 0x01,
+                Out2Mhz = 0x02,
+                Out50Mhz = 0x03,
+                OpenDrainOut10Mhz = 0x05,
+                OpenDrainOut2Mhz = 0x06,
+                OpenDrainOut50Mhz = 0x07,
+                AltFunctionBit = 0x08      //CNF1 bit turns output into alternate function output
+            };
+        };//struct NativePortBase
+
+        template< class T >
+    	class PortImplimentation: public NativePortBase
+        {
+            //Helper classes to acces GPIO registers nice and easy
+            IO_REG_WRAPPER(T::GetPortStuct().CRL,       CRL,        uint32_t);//Port configuration register low     [0x00]
+            IO_REG_WRAPPER(T::GetPortStuct().CRH,       CRH,        uint32_t);//Port configuration register high    [0x04]
+            IO_REG_WRAPPER(T::GetPortStuct().IDR,       IDR,        uint32_t);//Port input data register            [0x08]
+            IO_REG_WRAPPER(T::GetPortStuct().ODR,       ODR,        uint32_t);//Port output data register           [0x0C]
+            IO_REG_WRAPPER(T::GetPortStuct().BSRR,      BSRR,       uint32_t);//Port bit set/reset register         [0x10]
+            IO_REG_WRAPPER(T::GetPortStuct().LCKR,      LCKR,       uint32_t);//Port configuration lock register    [0x18]
+
+            //Write configuration nibble for pins in MASK. Half of port without pins in MASK is not touched at all
+            template< DataT MASK, uint32_t CONFIG >
+            static void WriteConfig()
+            {
+                const uint32_t LowMask = ConfigurationMask<MASK & 0xFF>::value;
+                const uint32_t HighMask = ConfigurationMask<(MASK >> 8) & 0xFF>::value;
+                if( LowMask )
+                    RmwPolicy::AndOr<CRL, ~(LowMask * 0x0F), LowMask * CONFIG>();
+                if( HighMask )
+                    RmwPolicy::AndOr<CRH, ~(HighMask * 0x0F), HighMask * CONFIG>();
+            }
+            //Change one bit of configuration nibble for pins in MASK
+            template< DataT MASK, uint32_t BIT, bool VALUE >
+            static void WriteConfigBit()
+            {
+                const uint32_t LowMask = ConfigurationMask<MASK & 0xFF>::value * BIT;
+                const uint32_t HighMask = ConfigurationMask<(MASK >> 8) & 0xFF>::value * BIT;
+                if( LowMask )
+                    RmwPolicy::AndOr<CRL, ~LowMask, VALUE ? LowMask : 0>();
+                if( HighMask )
+                    RmwPolicy::AndOr<CRH, ~HighMask, VALUE ? HighMask : 0>();
+            }
+            //Same with runtime mask
+            static void WriteConfig(DataT mask, uint32_t config)
+            {
+                const uint32_t lowMask = SpreadConfigurationMask( mask & 0xFF );
+                const uint32_t highMask = SpreadConfigurationMask( (mask >> 8) & 0xFF );
+                if( lowMask )
+                    RmwPolicy::AndOr<CRL>( ~(lowMask * 0x0F), lowMask * config );
+                if( highMask )
+                    RmwPolicy::AndOr<CRH>( ~(highMask * 0x0F), highMask * config );
+            }
+            static void WriteConfigBit(DataT mask, uint32_t bit, bool value)
+            {
+                const uint32_t lowMask = SpreadConfigurationMask( mask & 0xFF ) * bit;
+                const uint32_t highMask = SpreadConfigurationMask( (mask >> 8) & 0xFF ) * bit;
+                if( lowMask )
+                    RmwPolicy::AndOr<CRL>( ~lowMask, value ? lowMask : 0 );
+                if( highMask )
+                    RmwPolicy::AndOr<CRH>( ~highMask, value ? highMask : 0 );
+            }
+        #if TRIO_STM32_USE_BITBAND
+            //Single pin Read and Toggle through bit-band aliases of IDR and ODR
+            template< DataT MASK, bool SINGLE_PIN = (MASK != 0 && (MASK & (MASK - 1)) == 0) >
+            struct PinOp
+            {
+                static DataT Read(){ return (DataT)(IDR::Value() & MASK); }
+                static void Toggle(){ PortImplimentation::Toggle(MASK); }
+            };
+            template< DataT MASK >
+            struct PinOp< MASK, true >
+            {
+                typedef BitBandAlias< T::BaseAddress + 0x08, BitNumberOfMask<MASK>::value > IdrBit;
+                typedef BitBandAlias< T::BaseAddress + 0x0C, BitNumberOfMask<MASK>::value > OdrBit;
+                static DataT Read(){ return IdrBit::Reference() ? MASK : 0; }
+                static void Toggle(){ OdrBit::Reference() ^= 1; }   //other pins are not touched
+            };
+        #endif
+        public:
+            //=============Generic API. Everybody should implement and respect it==============
+    		static void Write(DataT value){ ODR::Set(value); }	//Write to GPIO output register
+            static DataT Read(){ return (DataT)IDR::Value(); }			//Read GPIO input register
+			static DataT ReadOutReg(){ return (DataT)ODR::Value(); }	//Read GPIO output register
+            //BSRR: low half sets pins, high half resets pins. Set wins if pin is in both halves.
+            static void Set(DataT value){ BSRR::Set(value); }
+    		static void Clear(DataT value){ BSRR::Set( (uint32_t)value << 16 ); }
+            static void ClearAndSet(DataT clearMask, DataT value){ BSRR::Set( ((uint32_t)clearMask << 16) | value ); }
+            //Only pins from value are written, so other pins of the port are safe even if ISR changes them
+    		static void Toggle(DataT value)
+            {
+                const uint32_t odr = ODR::Value();
+                BSRR::Set( ((odr & value) << 16) | (~odr & value) );
+            }
+
+            template<DataT value>
+    		static void Set(){ BSRR::Set(value); }
+    		template<DataT value>
+    		static void Clear(){ BSRR::Set( (uint32_t)value << 16 ); }
+            template<DataT clearMask, DataT value>
+    		static void ClearAndSet(){ BSRR::Set( ((uint32_t)clearMask << 16) | value ); }
+        #if TRIO_STM32_USE_BITBAND
+            template<DataT value>
+    		static void Toggle(){ PinOp<value>::Toggle(); }
+            template<DataT MASK>
+            static DataT Read(){ return PinOp<MASK>::Read(); }
+        #else
+            template<DataT value>
+    		static void Toggle(){ Toggle(value); }
+            //Read only pins in MASK
+            template<DataT MASK>
+            static DataT Read(){ return (DataT)(Read() & MASK); }
+        #endif
+
+            struct Configure
+            {
+                template<DataT MASK>
+                static void OutPushPull_Slow(){ WriteConfig<MASK, Out2Mhz>(); }
+                template<DataT MASK>
+                static void OutPushPull_Medium(){ WriteConfig<MASK, Out10Mhz>(); }
+                template<DataT MASK>
+                static void OutPushPull_Fast(){ WriteConfig<MASK, Out50Mhz>(); }
+                template<DataT MASK>
+                static void OutOpenDrain_Slow(){ WriteConfig<MASK, OpenDrainOut2Mhz>(); }
+                template<DataT MASK>
+                static void OutOpenDrain_Medium(){ WriteConfig<MASK, OpenDrainOut10Mhz>(); }
+                template<DataT MASK>
+                static void OutOpenDrain_Fast(){ WriteConfig<MASK, OpenDrainOut50Mhz>(); }
+
+                template<DataT MASK>
+                static void InFloating(){ WriteConfig<MASK, In>(); }
+                //Pull direction is selected by ODR bit
+                template<DataT MASK>
+                static void InPullUp(){ Set<MASK>(); WriteConfig<MASK, PullUpOrDownIn>(); }
+                template<DataT MASK>
+                static void InPullDown(){ Clear<MASK>(); WriteConfig<MASK, PullUpOrDownIn>(); }
+                template<DataT MASK>
+                static void InAnalog(){ WriteConfig<MASK, AnalogIn>(); }
+
+                //Please apply this to OUTPUT pins only! Output type and speed are kept
+                template<DataT MASK>
+                static void EnableAF(){ WriteConfigBit<MASK, AltFunctionBit, true>(); }
+                //Return pin to floating input, it doesn't drive the line. Configure pin as output with OutXXX if it should drive
+                template<DataT MASK>
+                static void DisableAF(){ WriteConfig<MASK, In>(); }
+                template<DataT MASK>
+                static void EnableInterrupt(){  } //Interrupt registers are in EXTI/AFIO modules, not in GPIO. So empty
+                template<DataT MASK>
+                static void DisableInterrupt(){  } //Interrupt registers are in EXTI/AFIO modules, not in GPIO. So empty
+
+                //Same configurations with runtime mask
+                static void OutPushPull_Slow(DataT mask){ WriteConfig( mask, Out2Mhz ); }
+                static void OutPushPull_Medium(DataT mask){ WriteConfig( mask, Out10Mhz ); }
+                static void OutPushPull_Fast(DataT mask){ WriteConfig( mask, Out50Mhz ); }
+                static void OutOpenDrain_Slow(DataT mask){ WriteConfig( mask, OpenDrainOut2Mhz ); }
+                static void OutOpenDrain_Medium(DataT mask){ WriteConfig( mask, OpenDrainOut10Mhz ); }
+                static void OutOpenDrain_Fast(DataT mask){ WriteConfig( mask, OpenDrainOut50Mhz ); }
+
+                static void InFloating(DataT mask){ WriteConfig( mask, In ); }
+                static void InPullUp(DataT mask){ Set(mask); WriteConfig( mask, PullUpOrDownIn ); }
+                static void InPullDown(DataT mask){ Clear(mask); WriteConfig( mask, PullUpOrDownIn ); }
+                static void InAnalog(DataT mask){ WriteConfig( mask, AnalogIn ); }
+
+                static void EnableAF(DataT mask){ WriteConfigBit( mask, AltFunctionBit, true ); }
+                static void DisableAF(DataT mask){ WriteConfig( mask, In ); }
+                static void EnableInterrupt(DataT mask){ }
+                static void DisableInterrupt(DataT mask){ }
+            };
+
+            //=============Hardware specific API for maximum flexibility======================
+            //TPin will expose this API to users as Pxn::HWSpecificAPI::HWSpecific_method();
+            //Some operations may need MASK to work, TPin will provide it.
+            template< DataT MASK=0 >
+            struct HWSpecificAPI
+            {
+                //Port clock
+                static void Enable(){ RmwPolicy::Or<RccApb2Enr, T::ClockEnableMask>(); }
+                static void Disable(){ RmwPolicy::And<RccApb2Enr, ~T::ClockEnableMask>(); }
+                //Lock configuration of MASK pins until next reset. Return true if lock is active
+                static bool LockConfiguration()
+                {
+                    const uint32_t LCKK = 1UL << 16;
+                    LCKR::Set( LCKK | MASK );
+                    LCKR::Set( MASK );
+                    LCKR::Set( LCKK | MASK );
+                    (void)LCKR::Value();
+                    return (LCKR::Value() & LCKK) != 0;
+                }
+                static GPIO_TypeDef &GetGPIORegsReference(){ return T::GetPortStuct(); }
+            };
+    	};//PortImplimentation
+    }//namespace Private
+
+
+//Port base address is needed only for bit-band aliases, so GPIOx_BASE is not required without bit-band
+#if TRIO_STM32_USE_BITBAND
+    #define TRIO_STM32_PORT_BASE(GPIOx_BASE) static const uint32_t BaseAddress = GPIOx_BASE;
+#else
+    #define TRIO_STM32_PORT_BASE(GPIOx_BASE)
+#endif
+
+//CLK_EN - port clock enable bit in RCC->APB2ENR
+#define MAKE_PORT(portName, className, ID, CLK_EN) \
+        class className :public Private::PortImplimentation<className>{\
+            static GPIO_TypeDef &GetPortStuct(){ return *portName; }\
+            TRIO_STM32_PORT_BASE(portName ## _BASE)\
+            friend class Private::PortImplimentation<className>;\
+            public:\
+            enum{Id = ID};\
+            typedef Private::RccApb2Enr ClockEnableReg;\
+            static const uint32_t ClockEnableMask = CLK_EN;\
+        };
+
+#ifdef GPIOA
+	#define TRIO_HAS_PORTA
+    MAKE_PORT(GPIOA, Porta, 'A', 1UL << 2)
+#endif
+
+#ifdef GPIOB
+	#define TRIO_HAS_PORTB
+    MAKE_PORT(GPIOB, Portb, 'B', 1UL << 3)
+#endif
+
+#ifdef GPIOC
+	#define TRIO_HAS_PORTC
+    MAKE_PORT(GPIOC, Portc, 'C', 1UL << 4)
+#endif
+
+#ifdef GPIOD
+	#define TRIO_HAS_PORTD
+    MAKE_PORT(GPIOD, Portd, 'D', 1UL << 5)
+#endif
+
+#ifdef GPIOE
+	#define TRIO_HAS_PORTE
+    MAKE_PORT(GPIOE, Porte, 'E', 1UL << 6)
+#endif
+
+#ifdef GPIOF
+	#define TRIO_HAS_PORTF
+    MAKE_PORT(GPIOF, Portf, 'F', 1UL << 7)
+#endif
+
+#ifdef GPIOG
+	#define TRIO_HAS_PORTG
+    MAKE_PORT(GPIOG, Portg, 'G', 1UL << 8)
+#endif
+}//namespace TRIO
+#endif /*TRIO_GPIO_IMPLEMENTATION_HPP_STM32F1_*/
@@ -0,0 +1,188 @@
+//*****************************************************************************
+// Author		: Trotskiy Vasily
+// Date			: jan 2020
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification, 
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice, 
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice, 
+// this list of conditions and the following disclaimer in the documentation and/or 
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND 
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, 
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY 
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#ifndef TRIO_PINS_DECLARATION_HPP_
+#define TRIO_PINS_DECLARATION_HPP_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+#ifndef TRIO_STM32_PORT_
+	#error "This file related to STM32 port! /STM32F1/trio_gpio_implementation.hpp should define TRIO_STM32_PORT_ macro"
+#endif 
+
+/*
+* Pins of all ports defined by CMSIS device header(GPIOA, GPIOB...) are declared here.
+* Optionally define TRIO_MCUSPECIFIC_PINDECL_FILE to declare only pins present in your package.
+*
+* example:
+* #define TRIO_MCUSPECIFIC_PINDECL_FILE "pins_decl/stm32f103c8.hpp"
+*
+* Double quotes "" around filename are necessary!!!!!
+*/
+namespace TRIO
+{	
+#if defined(TRIO_MCUSPECIFIC_PINDECL_FILE)
+	#include TRIO_MCUSPECIFIC_PINDECL_FILE
+#else
+/*No MCU specific pin declaration file is present! Just define all pins for all ports....*/
+	#ifdef TRIO_HAS_PORTA
+		TRIO_DEFINE_PA0()
+		TRIO_DEFINE_PA1()
+		TRIO_DEFINE_PA2()
+		TRIO_DEFINE_PA3()
+		TRIO_DEFINE_PA4()
+		TRIO_DEFINE_PA5()
+		TRIO_DEFINE_PA6()
+		TRIO_DEFINE_PA7()
+		TRIO_DEFINE_PA8()
+		TRIO_DEFINE_PA9()
+		TRIO_DEFINE_PA10()
+		TRIO_DEFINE_PA11()
+		TRIO_DEFINE_PA12()
+		TRIO_DEFINE_PA13()
+		TRIO_DEFINE_PA14()
+		TRIO_DEFINE_PA15()
+	#endif
+
+	#ifdef TRIO_HAS_PORTB
+		TRIO_DEFINE_PB0()
+		TRIO_DEFINE_PB1()
+		TRIO_DEFINE_PB2()
+		TRIO_DEFINE_PB3()
+		TRIO_DEFINE_PB4()
+		TRIO_DEFINE_PB5()
+		TRIO_DEFINE_PB6()
+		TRIO_DEFINE_PB7()
+		TRIO_DEFINE_PB8()
+		TRIO_DEFINE_PB9()
+		TRIO_DEFINE_PB10()
+		TRIO_DEFINE_PB11()
+		TRIO_DEFINE_PB12()
+		TRIO_DEFINE_PB13()
+		TRIO_DEFINE_PB14()
+		TRIO_DEFINE_PB15()
+	#endif
+
+	#ifdef TRIO_HAS_PORTC
+		TRIO_DEFINE_PC0()
+		TRIO_DEFINE_PC1()
+		TRIO_DEFINE_PC2()
+		TRIO_DEFINE_PC3()
+		TRIO_DEFINE_PC4()
+		TRIO_DEFINE_PC5()
+		TRIO_DEFINE_PC6()
+		TRIO_DEFINE_PC7()
+		TRIO_DEFINE_PC8()
+		TRIO_DEFINE_PC9()
+		TRIO_DEFINE_PC10()
+		TRIO_DEFINE_PC11()
+		TRIO_DEFINE_PC12()
+		TRIO_DEFINE_PC13()
+		TRIO_DEFINE_PC14()
+		TRIO_DEFINE_PC15()
+	#endif
+
+	#ifdef TRIO_HAS_PORTD
+		TRIO_DEFINE_PD0()
+		TRIO_DEFINE_PD1()
+		TRIO_DEFINE_PD2()
+		TRIO_DEFINE_PD3()
+		TRIO_DEFINE_PD4()
+		TRIO_DEFINE_PD5()
+		TRIO_DEFINE_PD6()
+		TRIO_DEFINE_PD7()
+		TRIO_DEFINE_PD8()
+		TRIO_DEFINE_PD9()
+		TRIO_DEFINE_PD10()
+		TRIO_DEFINE_PD11()
+		TRIO_DEFINE_PD12()
+		TRIO_DEFINE_PD13()
+		TRIO_DEFINE_PD14()
+		TRIO_DEFINE_PD15()
+	#endif
+
+	#ifdef TRIO_HAS_PORTE
+		TRIO_DEFINE_PE0()
+		TRIO_DEFINE_PE1()
+		TRIO_DEFINE_PE2()
+		TRIO_DEFINE_PE3()
+		TRIO_DEFINE_PE4()
+		TRIO_DEFINE_PE5()
+		TRIO_DEFINE_PE6()
+		TRIO_DEFINE_PE7()
+		TRIO_DEFINE_PE8()
+		TRIO_DEFINE_PE9()
+		TRIO_DEFINE_PE10()
+		TRIO_DEFINE_PE11()
+		TRIO_DEFINE_PE12()
+		TRIO_DEFINE_PE13()
+		TRIO_DEFINE_PE14()
+		TRIO_DEFINE_PE15()
+	#endif
+
+	#ifdef TRIO_HAS_PORTF
+		TRIO_DEFINE_PF0()
+		TRIO_DEFINE_PF1()
+		TRIO_DEFINE_PF2()
+		TRIO_DEFINE_PF3()
+		TRIO_DEFINE_PF4()
+		TRIO_DEFINE_PF5()
+		TRIO_DEFINE_PF6()
+		TRIO_DEFINE_PF7()
+		TRIO_DEFINE_PF8()
+		TRIO_DEFINE_PF9()
+		TRIO_DEFINE_PF10()
+		TRIO_DEFINE_PF11()
+		TRIO_DEFINE_PF12()
+		TRIO_DEFINE_PF13()
+		TRIO_DEFINE_PF14()
+		TRIO_DEFINE_PF15()
+	#endif
+
+	#ifdef TRIO_HAS_PORTG
+		TRIO_DEFINE_PG0()
+		TRIO_DEFINE_PG1()
+		TRIO_DEFINE_PG2()
+		TRIO_DEFINE_PG3()
+		TRIO_DEFINE_PG4()
+		TRIO_DEFINE_PG5()
+		TRIO_DEFINE_PG6()
+		TRIO_DEFINE_PG7()
+		TRIO_DEFINE_PG8()
+		TRIO_DEFINE_PG9()
+		TRIO_DEFINE_PG10()
+		TRIO_DEFINE_PG11()
+		TRIO_DEFINE_PG12()
+		TRIO_DEFINE_PG13()
+		TRIO_DEFINE_PG14()
+		TRIO_DEFINE_PG15()
+	#endif
+
+#endif //#if defined(TRIO_MCUSPECIFIC_PINDECL_FILE)
+}//namespace TRIO
+
+#endif /*TRIO_PINS_DECLARATION_HPP_*/
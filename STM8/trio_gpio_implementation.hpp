@@ -45,6 +45,9 @@ namespace TRIO
         {
             typedef uint8_t DataT;
             static const DataT Width = sizeof(DataT) * CHAR_BITS;
+            //No GPIO clock gating, see trio_clock_gating.hpp
+            typedef NullRegister ClockEnableReg;
+            static const uint32_t ClockEnableMask = 0;
 
             struct IOInternals
             {
@@ -67,19 +70,24 @@ namespace TRIO
 			static DataT Read(){ return IDR::Value(); }			//Read GPIO input register
             static DataT ReadOutReg(){ return ODR::Value(); }		//Read GPIO output register
             //static DataT PinRead(){ return IDR::Value(); }
-            static void Set(DataT value){ ODR::Or(value); }
-    		static void Clear(DataT value){ ODR::And( (DataT)~value ); }
-            static void ClearAndSet(DataT clearMask, DataT value){ ODR::AndOr((DataT)~clearMask, value); }
-    		static void Toggle(DataT value){ ODR::Xor(value); }
+            //read-modify-write operations are protected according to TRIO_RMW_POLICY, see trio_atomic.hpp
+            static void Set(DataT value){ RmwPolicy::Or<ODR>(value); }
+    		static void Clear(DataT value){ RmwPolicy::And<ODR>( (DataT)~value ); }
+            static void ClearAndSet(DataT clearMask, DataT value){ RmwPolicy::AndOr<ODR>((DataT)~clearMask, value); }
+    		static void Toggle(DataT value){ RmwPolicy::Xor<ODR>(value); }
 
             template<DataT value>
-    		static void Set(){ ODR::Or(value); }
+    		static void Set(){ RmwPolicy::Or<ODR, value>(); }
     		template<DataT value>
-    		static void Clear(){ ODR::And((DataT)~value); }
+    		static void Clear(){ RmwPolicy::And<ODR, (DataT)~value>(); }
             template<DataT clearMask, DataT value>
-    		static void ClearAndSet(){ ODR::AndOr((DataT)~clearMask, value); }
+    		static void ClearAndSet(){ RmwPolicy::AndOr<ODR, (DataT)~clearMask, value>(); }
             template<DataT value>
-    		static void Toggle(){ ODR::Xor(value); }
+    		static void Toggle(){ RmwPolicy::Xor<ODR, value>(); }
+
+            //Read only pins in MASK. Ports may read single pin faster
+            template<DataT MASK>
+            static DataT Read(){ return (DataT)(Read() & MASK); }
 
             struct Configure
             {
@@ -113,6 +121,55 @@ namespace TRIO
                 static void EnableInterrupt(){ CR2::Or(MASK); } //Please apply this to INPUT pins only!
                 template<DataT MASK>
                 static void DisableInterrupt(){ CR2::And( (DataT)~MASK ); } //Please apply this to INPUT pins only!
+
+                //Same configurations with runtime mask
+                static void OutPushPull_Slow(DataT mask){ DDR::Or(mask); CR1::Or(mask); CR2::And( (DataT)~mask ); }
+                static void OutPushPull_Medium(DataT mask){ OutPushPull_Fast(mask); }
+                static void OutPushPull_Fast(DataT mask){ DDR::Or(mask); CR1::Or(mask); CR2::Or(mask); }
+                static void OutOpenDrain_Slow(DataT mask){ DDR::Or(mask); CR1::And( (DataT)~mask ); CR2::And( (DataT)~mask ); }
+                static void OutOpenDrain_Medium(DataT mask){ OutOpenDrain_Fast(mask); }
+                static void OutOpenDrain_Fast(DataT mask){ DDR::Or(mask); CR1::And( (DataT)~mask ); CR2::Or(mask); }
+
+                static void InFloating(DataT mask){ DDR::And( (DataT)~mask ); CR1::And( (DataT)~mask ); CR2::And( (DataT)~mask ); }
+                static void InPullUp(DataT mask){ DDR::And( (DataT)~mask ); CR1::Or(mask); CR2::And( (DataT)~mask ); }
+                static void InPullDown(DataT mask){ InFloating(mask); }
+                static void InAnalog(DataT mask){ InFloating(mask); }
+
+                static void EnableAF(DataT mask){ }
+                static void DisableAF(DataT mask){ }
+                static void EnableInterrupt(DataT mask){ CR2::Or(mask); }
+                static void DisableInterrupt(DataT mask){ CR2::And( (DataT)~mask ); }
+            };
+
+            //Same configurations as in Configure, but with runtime masks.
+            //Changes are collected and applied by Commit() with one read and one write per DDR, CR1, CR2
+            //See trio_config_transaction.hpp
+            class ConfigTransaction
+            {
+                StagedRegWrite<DDR> ddr;
+                StagedRegWrite<CR1> cr1;
+                StagedRegWrite<CR2> cr2;
+            public:
+                void OutPushPull_Slow(DataT mask){ ddr.Or(mask); cr1.Or(mask); cr2.And( (DataT)~mask ); }
+                void OutPushPull_Medium(DataT mask){ OutPushPull_Fast(mask); }
+                void OutPushPull_Fast(DataT mask){ ddr.Or(mask); cr1.Or(mask); cr2.Or(mask); }
+                void OutOpenDrain_Slow(DataT mask){ ddr.Or(mask); cr1.And( (DataT)~mask ); cr2.And( (DataT)~mask ); }
+                void OutOpenDrain_Medium(DataT mask){ OutOpenDrain_Fast(mask); }
+                void OutOpenDrain_Fast(DataT mask){ ddr.Or(mask); cr1.And( (DataT)~mask ); cr2.Or(mask); }
+
+                void InFloating(DataT mask){ ddr.And( (DataT)~mask ); cr1.And( (DataT)~mask ); cr2.And( (DataT)~mask ); }
+                void InPullUp(DataT mask){ ddr.And( (DataT)~mask ); cr1.Or(mask); cr2.And( (DataT)~mask ); }
+                void InPullDown(DataT mask){ InFloating(mask); } //Pull down is not supported in STM8
+                void InAnalog(DataT mask){ InFloating(mask); }
+
+                void EnableAF(DataT mask){ }   //there is no special bit for AF in STM8
+                void DisableAF(DataT mask){ }  //there is no special bit for AF in STM8
+                void EnableInterrupt(DataT mask){ cr2.Or(mask); } //Please apply this to INPUT pins only!
+                void DisableInterrupt(DataT mask){ cr2.And( (DataT)~mask ); } //Please apply this to INPUT pins only!
+
+                //Same register order as in Configure
+                void Commit(){ ddr.Commit(); cr1.Commit(); cr2.Commit(); }
+                void Cancel(){ ddr.Cancel(); cr1.Cancel(); cr2.Cancel(); }
             };
 
             //=============Hardware specific API for maximum flexibility======================
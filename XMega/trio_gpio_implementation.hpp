@@ -37,6 +37,21 @@
 //#define TRIO_AVR_PORT_
 #define TRIO_XMEGA_PORT_
 
+#include "loki/TypeManip.h"
+
+/*Virtual ports
+* Up to 4 ports can be mapped to VPORT0..3. Virtual port registers are in bit addressable IO space,
+* so mapped port uses 1 cycle IN/OUT/SBI/CBI instead of LDS/STS of extended IO PORT_t:
+* Write, Read, ReadOutReg           - VPORTn.OUT, VPORTn.IN
+* compile time single pin Set/Clear - SBI/CBI on VPORTn.OUT(atomic)
+* multi pin Set/Clear/Toggle        - still PORT_t OUTSET/OUTCLR/OUTTGL, because they are atomic and OR/AND on VPORT is not
+*
+* Define mapping before #include "trio.hpp":
+* #define TRIO_XMEGA_MAP_PORTC_TO_VPORT 0
+* #define TRIO_XMEGA_MAP_PORTD_TO_VPORT 1
+* and call TRIO::MapVirtualPorts() once at start up, before using mapped ports.
+* Only one port can be mapped to each VPORT.*/
+
 namespace TRIO
 {
     namespace Private
@@ -45,8 +60,19 @@ namespace TRIO
         {	
             typedef uint8_t DataT;
             enum{ Width = sizeof(DataT) * CHAR_BITS };                       
+            //No GPIO clock gating, see trio_clock_gating.hpp
+            typedef NullRegister ClockEnableReg;
+            static const uint32_t ClockEnableMask = 0;
         };//struct NativePortBase	    	
 
+        //VPORTn by number. Not mapped port(-1) has no virtual port
+        template< int N >
+        struct VPortByNumber;
+        template<> struct VPortByNumber<0>{ static VPORT_t &Get(){ return VPORT0; } };
+        template<> struct VPortByNumber<1>{ static VPORT_t &Get(){ return VPORT1; } };
+        template<> struct VPortByNumber<2>{ static VPORT_t &Get(){ return VPORT2; } };
+        template<> struct VPortByNumber<3>{ static VPORT_t &Get(){ return VPORT3; } };
+
         template< class T >
     	class PortImplimentation: public NativePortBase
         {
@@ -73,7 +99,46 @@ namespace TRIO
 			IO_REG_WRAPPER(T::GetPORT_tRef().PIN5CTRL, PIN5CTRL, DataT);
 			IO_REG_WRAPPER(T::GetPORT_tRef().PIN6CTRL, PIN6CTRL, DataT);
 			IO_REG_WRAPPER(T::GetPORT_tRef().PIN7CTRL, PIN7CTRL, DataT);
+			//Virtual port registers. Used only if port is mapped to VPORT
+			IO_REG_WRAPPER(VPortByNumber<T::VPortNumber>::Get().OUT, VOUT, DataT);
+			IO_REG_WRAPPER(VPortByNumber<T::VPortNumber>::Get().IN, VIN, DataT);
+
+			//Output and input registers: virtual if port is mapped.
+			//Template is needed because T is not complete yet when PortImplimentation is instantiated
+			template< int DONTCARE=0 >
+			struct VPort
+			{
+				BOOST_STATIC_ASSERT( T::VPortNumber < 4 );
+				static const bool Mapped = T::VPortNumber >= 0;
+				typedef typename Loki::Select< Mapped, VOUT, OUT >::Result OUTx;
+				typedef typename Loki::Select< Mapped, VIN, IN >::Result INx;
+			};
+
+			//Compile time Set/Clear. Single pin of mapped port - SBI/CBI on virtual port, otherwise OUTSET/OUTCLR
+			template< bool SINGLE_BIT_VPORT, int DONTCARE=0 >
+			struct SetClearOp
+			{
+				static void Set(DataT value){ OUTSET::Set(value); }
+				static void Clear(DataT value){ OUTCLR::Set(value); }
+			};
+			template< int DONTCARE >
+			struct SetClearOp<true, DONTCARE>
+			{
+				static void Set(DataT value){ VOUT::Or(value); }
+				static void Clear(DataT value){ VOUT::And( (DataT)~value ); }
+			};
+			template< DataT MASK >
+			struct IsSingleBitVPortOp{ static const bool value = VPort<>::Mapped && MASK != 0 && (MASK & (MASK - 1)) == 0; };
 			
+			//PINnCTRL = value for all pins in runtime mask. Multi-pin configuration writes them at once
+			static void WritePinCtrl(DataT mask, uint8_t value)
+			{
+				if( !mask )	//PIN0CTRL would be written otherwise
+					return;
+				PORTCFG.MPCMASK = mask;
+				PIN0CTRL::Set(value);
+			}
+
 			//Select PINnCTRL register by mask meta function
 			template< DataT MASK, int DONTCARE=0 >
 			struct PinCtrlByMask{ typedef PIN0CTRL Result; enum{Multipin=1}; };
@@ -95,24 +160,28 @@ namespace TRIO
 			struct PinCtrlByMask<((DataT)1U << 7), DONTCARE >{ typedef PIN7CTRL Result; enum{Multipin=0}; };
         public:           
             //=============Generic API. Everybody should implement and respect it==============
-    		static void Write(DataT value){ OUT::Set(value); }	//Write to GPIO output register
-			static DataT Read(){ return IN::Get(); }			//Read GPIO input register
-            static DataT ReadOutReg(){ return OUT::Get(); }		//Read GPIO output register
-			//static DataT PinRead(){ return IN::Get(); }
+    		static void Write(DataT value){ VPort<>::OUTx::Set(value); }	//Write to GPIO output register
+			static DataT Read(){ return VPort<>::INx::Value(); }			//Read GPIO input register
+            static DataT ReadOutReg(){ return VPort<>::OUTx::Value(); }		//Read GPIO output register
+			//static DataT PinRead(){ return IN::Value(); }
             static void Set(DataT value){ OUTSET::Set(value); }
     		static void Clear(DataT value){ OUTCLR::Set(value); }
             static void ClearAndSet(DataT clearMask, DataT value){ Clear(clearMask); Set(value); }
     		static void Toggle(DataT value){ OUTTGL::Set(value); }
 
             template<DataT value>
-    		static void Set(){ OUTSET::Set(value); }
+    		static void Set(){ SetClearOp< IsSingleBitVPortOp<value>::value >::Set(value); }
     		template<DataT value>
-    		static void Clear(){ OUTCLR::Set(value); }
+    		static void Clear(){ SetClearOp< IsSingleBitVPortOp<value>::value >::Clear(value); }
             template<DataT clearMask, DataT value>
     		static void ClearAndSet(){ Clear(clearMask); Set(value); }
             template<DataT value>
     		static void Toggle(){ OUTTGL::Set(value); }
 
+            //Read only pins in MASK. Ports may read single pin faster
+            template<DataT MASK>
+            static DataT Read(){ return (DataT)(Read() & MASK); }
+
             struct Configure
             {   
                 template<DataT MASK>
@@ -205,10 +274,29 @@ namespace TRIO
                 static void EnableAF(){ }   //there is no special bit for AF in XMEGA
                 template<DataT MASK>
                 static void DisableAF(){ }  //there is no special bit for AF in XMEGA
+                //Pins are added to INT0MASK only. Sense(ISC) and INT0 level(INTCTRL) are set by HWSpecificAPI
                 template<DataT MASK>
-                static void EnableInterrupt(){  } //XMEGA has many Interrupts settings, use HWSpecificAPI to configure
+                static void EnableInterrupt(){ INT0MASK::Or(MASK); }
                 template<DataT MASK>
-                static void DisableInterrupt(){  } //XMEGA has many Interrupt settings, use HWSpecificAPI to configure
+                static void DisableInterrupt(){ INT0MASK::And( (DataT)~MASK ); }
+
+                //Same configurations with runtime mask
+                static void OutPushPull_Slow(DataT mask){ DIRSET::Set(mask); WritePinCtrl( mask, PORT_SRLEN_bm | PORT_OPC_TOTEM_gc ); }
+                static void OutPushPull_Medium(DataT mask){ OutPushPull_Fast(mask); }
+                static void OutPushPull_Fast(DataT mask){ DIRSET::Set(mask); WritePinCtrl( mask, PORT_OPC_TOTEM_gc ); }
+                static void OutOpenDrain_Slow(DataT mask){ DIRSET::Set(mask); WritePinCtrl( mask, PORT_SRLEN_bm | PORT_OPC_WIREDAND_gc ); }
+                static void OutOpenDrain_Medium(DataT mask){ OutOpenDrain_Fast(mask); }
+                static void OutOpenDrain_Fast(DataT mask){ DIRSET::Set(mask); WritePinCtrl( mask, PORT_OPC_WIREDAND_gc ); }
+
+                static void InFloating(DataT mask){ DIRCLR::Set(mask); WritePinCtrl( mask, PORT_OPC_TOTEM_gc ); }
+                static void InPullUp(DataT mask){ DIRCLR::Set(mask); WritePinCtrl( mask, PORT_OPC_PULLUP_gc ); }
+                static void InPullDown(DataT mask){ DIRCLR::Set(mask); WritePinCtrl( mask, PORT_OPC_PULLDOWN_gc ); }
+                static void InAnalog(DataT mask){ DIRCLR::Set(mask); WritePinCtrl( mask, PORT_OPC_TOTEM_gc | PORT_ISC_INPUT_DISABLE_gc ); }
+
+                static void EnableAF(DataT mask){ }
+                static void DisableAF(DataT mask){ }
+                static void EnableInterrupt(DataT mask){ INT0MASK::Or(mask); }
+                static void DisableInterrupt(DataT mask){ INT0MASK::And( (DataT)~mask ); }
             };
 
             //=============Hardware specific API for maximum flexibility======================            
@@ -217,10 +305,21 @@ namespace TRIO
             template< DataT MASK=0 >
             struct HWSpecificAPI
             {
-				//TODO: Add support of remapping and virtual ports
-				
 				//Return reference to port registers for super low level hacks )
 				static PORT_t &GetGPIORegsReference(){ return T::GetPORT_tRef(); }
+				//Virtual port registers. Only for ports mapped to VPORT
+				static VPORT_t &GetVPORTRegsReference(){ return VPortByNumber<T::VPortNumber>::Get(); }
+
+				//Map port to its VPORT(see TRIO_XMEGA_MAP_PORTx_TO_VPORT). Does nothing for not mapped port
+				static void MapVirtualPort()
+				{
+					if( !VPort<>::Mapped )
+						return;
+					//VPCTRLA: VP1MAP[7:4] VP0MAP[3:0], VPCTRLB: VP3MAP[7:4] VP2MAP[3:0]
+					register8_t &vpctrl = (T::VPortNumber < 2) ? PORTCFG.VPCTRLA : PORTCFG.VPCTRLB;
+					const uint8_t shift = (T::VPortNumber & 1) ? 4 : 0;
+					vpctrl = (uint8_t)( (vpctrl & ~(0x0F << shift)) | (T::PortIndex << shift) );
+				}
 				
 				/*
 				* Set XMEGA specific output configurations
@@ -232,7 +331,7 @@ namespace TRIO
 				static void SetOPC_BUSKEEPER()
 				{
 					typedef typename PinCtrlByMask<MASK>::Result PINnCTRL;
-					DataT temp_PINnCTRL = PINnCTRL::Get();
+					DataT temp_PINnCTRL = PINnCTRL::Value();
 					if( PinCtrlByMask<MASK>::Multipin )
 						PORTCFG.MPCMASK = MASK;
 					PINnCTRL::Set( temp_PINnCTRL | PORT_OPC_BUSKEEPER_gc );
@@ -240,7 +339,7 @@ namespace TRIO
 				static void SetOPC_WIREDOR()
 				{
 					typedef typename PinCtrlByMask<MASK>::Result PINnCTRL;
-					DataT temp_PINnCTRL = PINnCTRL::Get();
+					DataT temp_PINnCTRL = PINnCTRL::Value();
 					if( PinCtrlByMask<MASK>::Multipin )
 						PORTCFG.MPCMASK = MASK;
 					PINnCTRL::Set( temp_PINnCTRL | PORT_OPC_WIREDOR_gc );
@@ -248,7 +347,7 @@ namespace TRIO
 				static void SetOPC_WIREDORPULL()
 				{
 					typedef typename PinCtrlByMask<MASK>::Result PINnCTRL;
-					DataT temp_PINnCTRL = PINnCTRL::Get();
+					DataT temp_PINnCTRL = PINnCTRL::Value();
 					if( PinCtrlByMask<MASK>::Multipin )
 						PORTCFG.MPCMASK = MASK;
 					PINnCTRL::Set( temp_PINnCTRL | PORT_OPC_WIREDORPULL_gc );
@@ -256,7 +355,7 @@ namespace TRIO
 				static void SetOPC_WIREDANDPULL()
 				{
 					typedef typename PinCtrlByMask<MASK>::Result PINnCTRL;
-					DataT temp_PINnCTRL = PINnCTRL::Get();
+					DataT temp_PINnCTRL = PINnCTRL::Value();
 					if( PinCtrlByMask<MASK>::Multipin )
 						PORTCFG.MPCMASK = MASK;
 					PINnCTRL::Set( temp_PINnCTRL | PORT_OPC_WIREDANDPULL_gc );
@@ -273,13 +372,13 @@ namespace TRIO
 				* Pd0::HWSpecificAPI::EnableInINT0MASKRegister(); //Now Enabele pin in interrupt mask
 				*/
 				static void EnableInINT0MASKRegister(){ INT0MASK::Or(MASK); }
-				static void DisableInINT0MASKRegister(){ INT0MASK::Or(MASK); }
+				static void DisableInINT0MASKRegister(){ INT0MASK::And( (DataT)~MASK ); }
 				static void EnableInINT1MASKRegister(){ INT1MASK::Or(MASK); }
-				static void DisableInINT1MASKRegister(){ INT1MASK::Or(MASK); }					
+				static void DisableInINT1MASKRegister(){ INT1MASK::And( (DataT)~MASK ); }					
 				static void SetISC_BOTHEDGES()
 				{					
 					typedef typename PinCtrlByMask<MASK>::Result PINnCTRL;
-					DataT temp_PINnCTRL = PINnCTRL::Get();
+					DataT temp_PINnCTRL = PINnCTRL::Value();
 					if( PinCtrlByMask<MASK>::Multipin )
 						PORTCFG.MPCMASK = MASK;					
 					PINnCTRL::Set( temp_PINnCTRL | PORT_ISC_BOTHEDGES_gc );
@@ -287,7 +386,7 @@ namespace TRIO
 				static void SetISC_RISING()
 				{
 					typedef typename PinCtrlByMask<MASK>::Result PINnCTRL;
-					DataT temp_PINnCTRL = PINnCTRL::Get();
+					DataT temp_PINnCTRL = PINnCTRL::Value();
 					if( PinCtrlByMask<MASK>::Multipin )
 						PORTCFG.MPCMASK = MASK;
 					PINnCTRL::Set( temp_PINnCTRL | PORT_ISC_RISING_gc );
@@ -295,7 +394,7 @@ namespace TRIO
 				static void SetISC_FALLING()
 				{
 					typedef typename PinCtrlByMask<MASK>::Result PINnCTRL;
-					DataT temp_PINnCTRL = PINnCTRL::Get();
+					DataT temp_PINnCTRL = PINnCTRL::Value();
 					if( PinCtrlByMask<MASK>::Multipin )
 						PORTCFG.MPCMASK = MASK;
 					PINnCTRL::Set( temp_PINnCTRL | PORT_ISC_FALLING_gc );
@@ -303,7 +402,7 @@ namespace TRIO
 				static void SetISC_LEVEL()
 				{
 					typedef typename PinCtrlByMask<MASK>::Result PINnCTRL;
-					DataT temp_PINnCTRL = PINnCTRL::Get();
+					DataT temp_PINnCTRL = PINnCTRL::Value();
 					if( PinCtrlByMask<MASK>::Multipin )
 						PORTCFG.MPCMASK = MASK;
 					PINnCTRL::Set( temp_PINnCTRL | PORT_ISC_LEVEL_gc );
@@ -312,66 +411,206 @@ namespace TRIO
     	};//PortImplimentation
     }//namespace Private
 
-#define MAKE_PORT(portName, className, ID) \
+//VPORT - virtual port number or -1 if port is not mapped
+//PortIndex is port number used by VPCTRL registers(A=0, B=1... there is no I and O ports)
+#define MAKE_PORT(portName, className, ID, VPORT) \
 class className :public Private::PortImplimentation<className>{\
 	static PORT_t &GetPORT_tRef(){return portName;}\
 	friend class Private::PortImplimentation<className>;\
 	public:\
-	enum{Id = ID};\
+	enum{Id = ID, VPortNumber = VPORT, PortIndex = ID - 'A' - (ID > 'I') - (ID > 'O')};\
 };
 
 
 #ifdef PORTA
     #define TRIO_HAS_PORTA
-    MAKE_PORT(PORTA, Porta, 'A')
+    #ifndef TRIO_XMEGA_MAP_PORTA_TO_VPORT
+        #define TRIO_XMEGA_MAP_PORTA_TO_VPORT -1
+    #endif
+    MAKE_PORT(PORTA, Porta, 'A', TRIO_XMEGA_MAP_PORTA_TO_VPORT)
 #endif
 #ifdef PORTB
     #define TRIO_HAS_PORTB
-    MAKE_PORT(PORTB, Portb, 'B')
+    #ifndef TRIO_XMEGA_MAP_PORTB_TO_VPORT
+        #define TRIO_XMEGA_MAP_PORTB_TO_VPORT -1
+    #endif
+    MAKE_PORT(PORTB, Portb, 'B', TRIO_XMEGA_MAP_PORTB_TO_VPORT)
 #endif
 #ifdef PORTC
     #define TRIO_HAS_PORTC
-    MAKE_PORT(PORTC, Portc, 'C')
+    #ifndef TRIO_XMEGA_MAP_PORTC_TO_VPORT
+        #define TRIO_XMEGA_MAP_PORTC_TO_VPORT -1
+    #endif
+    MAKE_PORT(PORTC, Portc, 'C', TRIO_XMEGA_MAP_PORTC_TO_VPORT)
 #endif
 #ifdef PORTD
     #define TRIO_HAS_PORTD
-    MAKE_PORT(PORTD, Portd, 'D')
+    #ifndef TRIO_XMEGA_MAP_PORTD_TO_VPORT
+        #define TRIO_XMEGA_MAP_PORTD_TO_VPORT -1
+    #endif
+    MAKE_PORT(PORTD, Portd, 'D', TRIO_XMEGA_MAP_PORTD_TO_VPORT)
 #endif
 #ifdef PORTE
     #define TRIO_HAS_PORTE
-    MAKE_PORT(PORTE, Porte, 'E')
+    #ifndef TRIO_XMEGA_MAP_PORTE_TO_VPORT
+        #define TRIO_XMEGA_MAP_PORTE_TO_VPORT -1
+    #endif
+    MAKE_PORT(PORTE, Porte, 'E', TRIO_XMEGA_MAP_PORTE_TO_VPORT)
 #endif
 #ifdef PORTF
     #define TRIO_HAS_PORTF
-    MAKE_PORT(PORTF, Portf, 'F')
+    #ifndef TRIO_XMEGA_MAP_PORTF_TO_VPORT
+        #define TRIO_XMEGA_MAP_PORTF_TO_VPORT -1
+    #endif
+    MAKE_PORT(PORTF, Portf, 'F', TRIO_XMEGA_MAP_PORTF_TO_VPORT)
 #endif
 #ifdef PORTG
     #define TRIO_HAS_PORTG
-    MAKE_PORT(PORTG, Portg, 'G')
+    #ifndef TRIO_XMEGA_MAP_PORTG_TO_VPORT
+        #define TRIO_XMEGA_MAP_PORTG_TO_VPORT -1
+    #endif
+    MAKE_PORT(PORTG, Portg, 'G', TRIO_XMEGA_MAP_PORTG_TO_VPORT)
 #endif
 #ifdef PORTH
     #define TRIO_HAS_PORTH
-    MAKE_PORT(PORTH, Porth, 'H')
+    #ifndef TRIO_XMEGA_MAP_PORTH_TO_VPORT
+        #define TRIO_XMEGA_MAP_PORTH_TO_VPORT -1
+    #endif
+    MAKE_PORT(PORTH, Porth, 'H', TRIO_XMEGA_MAP_PORTH_TO_VPORT)
 #endif
 #ifdef PORTI
     #define TRIO_HAS_PORTI
-    MAKE_PORT(PORTI, Porti, 'I')
+    #ifndef TRIO_XMEGA_MAP_PORTI_TO_VPORT
+        #define TRIO_XMEGA_MAP_PORTI_TO_VPORT -1
+    #endif
+    MAKE_PORT(PORTI, Porti, 'I', TRIO_XMEGA_MAP_PORTI_TO_VPORT)
 #endif
 #ifdef PORTJ
     #define TRIO_HAS_PORTJ
-    MAKE_PORT(PORTJ, Portj, 'J')
+    #ifndef TRIO_XMEGA_MAP_PORTJ_TO_VPORT
+        #define TRIO_XMEGA_MAP_PORTJ_TO_VPORT -1
+    #endif
+    MAKE_PORT(PORTJ, Portj, 'J', TRIO_XMEGA_MAP_PORTJ_TO_VPORT)
 #endif
 #ifdef PORTK
     #define TRIO_HAS_PORTK
-    MAKE_PORT(PORTK, Portk, 'K')
+    #ifndef TRIO_XMEGA_MAP_PORTK_TO_VPORT
+        #define TRIO_XMEGA_MAP_PORTK_TO_VPORT -1
+    #endif
+    MAKE_PORT(PORTK, Portk, 'K', TRIO_XMEGA_MAP_PORTK_TO_VPORT)
 #endif
 #ifdef PORTQ
     #define TRIO_HAS_PORTQ
-    MAKE_PORT(PORTQ, Portq, 'Q')
+    #ifndef TRIO_XMEGA_MAP_PORTQ_TO_VPORT
+        #define TRIO_XMEGA_MAP_PORTQ_TO_VPORT -1
+    #endif
+    MAKE_PORT(PORTQ, Portq, 'Q', TRIO_XMEGA_MAP_PORTQ_TO_VPORT)
 #endif
 #ifdef PORTR
     #define TRIO_HAS_PORTR
-    MAKE_PORT(PORTR, Portr, 'R')
+    #ifndef TRIO_XMEGA_MAP_PORTR_TO_VPORT
+        #define TRIO_XMEGA_MAP_PORTR_TO_VPORT -1
+    #endif
+    MAKE_PORT(PORTR, Portr, 'R', TRIO_XMEGA_MAP_PORTR_TO_VPORT)
 #endif    
+
+    namespace Private
+    {
+        //Number of ports mapped to VPORTn
+        template< int N >
+        struct PortsMappedToVPort
+        {
+            enum{ value = 0
+        #ifdef TRIO_HAS_PORTA
+                + (Porta::VPortNumber == N)
+        #endif
+        #ifdef TRIO_HAS_PORTB
+                + (Portb::VPortNumber == N)
+        #endif
+        #ifdef TRIO_HAS_PORTC
+                + (Portc::VPortNumber == N)
+        #endif
+        #ifdef TRIO_HAS_PORTD
+                + (Portd::VPortNumber == N)
+        #endif
+        #ifdef TRIO_HAS_PORTE
+                + (Porte::VPortNumber == N)
+        #endif
+        #ifdef TRIO_HAS_PORTF
+                + (Portf::VPortNumber == N)
+        #endif
+        #ifdef TRIO_HAS_PORTG
+                + (Portg::VPortNumber == N)
+        #endif
+        #ifdef TRIO_HAS_PORTH
+                + (Porth::VPortNumber == N)
+        #endif
+        #ifdef TRIO_HAS_PORTI
+                + (Porti::VPortNumber == N)
+        #endif
+        #ifdef TRIO_HAS_PORTJ
+                + (Portj::VPortNumber == N)
+        #endif
+        #ifdef TRIO_HAS_PORTK
+                + (Portk::VPortNumber == N)
+        #endif
+        #ifdef TRIO_HAS_PORTQ
+                + (Portq::VPortNumber == N)
+        #endif
+        #ifdef TRIO_HAS_PORTR
+                + (Portr::VPortNumber == N)
+        #endif
+            };
+        };
+    }
+    //Only one port can be mapped to each VPORT, check TRIO_XMEGA_MAP_PORTx_TO_VPORT
+    BOOST_STATIC_ASSERT( Private::PortsMappedToVPort<0>::value <= 1 );
+    BOOST_STATIC_ASSERT( Private::PortsMappedToVPort<1>::value <= 1 );
+    BOOST_STATIC_ASSERT( Private::PortsMappedToVPort<2>::value <= 1 );
+    BOOST_STATIC_ASSERT( Private::PortsMappedToVPort<3>::value <= 1 );
+
+    //Apply all TRIO_XMEGA_MAP_PORTx_TO_VPORT mappings. Call once at start up
+    inline void MapVirtualPorts()
+    {
+    #ifdef TRIO_HAS_PORTA
+        Porta::HWSpecificAPI<>::MapVirtualPort();
+    #endif
+    #ifdef TRIO_HAS_PORTB
+        Portb::HWSpecificAPI<>::MapVirtualPort();
+    #endif
+    #ifdef TRIO_HAS_PORTC
+        Portc::HWSpecificAPI<>::MapVirtualPort();
+    #endif
+    #ifdef TRIO_HAS_PORTD
+        Portd::HWSpecificAPI<>::MapVirtualPort();
+    #endif
+    #ifdef TRIO_HAS_PORTE
+        Porte::HWSpecificAPI<>::MapVirtualPort();
+    #endif
+    #ifdef TRIO_HAS_PORTF
+        Portf::HWSpecificAPI<>::MapVirtualPort();
+    #endif
+    #ifdef TRIO_HAS_PORTG
+        Portg::HWSpecificAPI<>::MapVirtualPort();
+    #endif
+    #ifdef TRIO_HAS_PORTH
+        Porth::HWSpecificAPI<>::MapVirtualPort();
+    #endif
+    #ifdef TRIO_HAS_PORTI
+        Porti::HWSpecificAPI<>::MapVirtualPort();
+    #endif
+    #ifdef TRIO_HAS_PORTJ
+        Portj::HWSpecificAPI<>::MapVirtualPort();
+    #endif
+    #ifdef TRIO_HAS_PORTK
+        Portk::HWSpecificAPI<>::MapVirtualPort();
+    #endif
+    #ifdef TRIO_HAS_PORTQ
+        Portq::HWSpecificAPI<>::MapVirtualPort();
+    #endif
+    #ifdef TRIO_HAS_PORTR
+        Portr::HWSpecificAPI<>::MapVirtualPort();
+    #endif
+    }
 }//namespace TRIO
 #endif /*TRIO_GPIO_IMPLEMENTATION_HPP_XMEGA_*/
@@ -0,0 +1,134 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Classic AVR pin change interrupt test against PORTx/DDRx/PINx and PCINT registers in RAM.
+// Checks that ConfigTransaction stages PCMSKn changes until Commit() with the last call winning,
+// Commit() sets PCIEn in PCICR, Cancel(), and PinChangeDispatcher::EnableInterrupts() on two PCINT groups.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <assert.h>
+
+volatile uint8_t PORTB, DDRB, PINB, PORTC, DDRC, PINC, PORTD, DDRD, PIND;
+volatile uint8_t PCMSK0, PCMSK1, PCICR;
+#define PORTB PORTB
+#define PORTC PORTC
+#define PORTD PORTD
+#define PCMSK0 PCMSK0
+#define PCMSK1 PCMSK1
+#define PCICR PCICR
+enum{ PCIE0 = 0, PCIE1 = 1 };
+
+#define TRIO_AVR_PCINT_B 0
+#define TRIO_AVR_PCINT_C 1
+#include "trio.hpp"
+
+using namespace TRIO;
+
+static void ResetRegs()
+{
+    PORTB = DDRB = PINB = PORTC = DDRC = PINC = PORTD = DDRD = PIND = 0;
+    PCMSK0 = PCMSK1 = PCICR = 0;
+}
+
+static void TestConfigTransaction()
+{
+    ResetRegs();
+    DDRB = 0xFF;
+    PCMSK0 = 0x81;
+
+    ConfigTransaction<Portb> tr;
+    tr.InPullUp( 0x0F );
+    tr.EnableInterrupt( 0x03 );
+    tr.DisableInterrupt( 0x01 );	//last call wins: Pb0 disabled
+    assert( DDRB == 0xFF && PORTB == 0 && PCMSK0 == 0x81 && PCICR == 0 );	//staged only
+
+    tr.Commit();
+    assert( DDRB == 0xF0 && PORTB == 0x0F );
+    assert( PCMSK0 == 0x82 );
+    assert( PCICR == (1 << PCIE0) );
+
+    //Commit drops staged changes
+    PCMSK0 = 0;
+    PCICR = 0;
+    tr.Commit();
+    assert( PCMSK0 == 0 && PCICR == 0 );
+
+    //Disable only: PCIE is not touched
+    PCMSK0 = 0x0C;
+    tr.DisableInterrupt( 0x04 );
+    tr.Commit();
+    assert( PCMSK0 == 0x08 && PCICR == 0 );
+
+    tr.EnableInterrupt( 0x10 );
+    tr.Cancel();
+    tr.Commit();
+    assert( PCMSK0 == 0x08 && PCICR == 0 );
+
+    //Other group
+    ConfigTransaction<Portc> trc;
+    trc.EnableInterrupt( 0x04 );
+    trc.Commit();
+    assert( PCMSK1 == 0x04 && PCICR == (1 << PCIE1) && PCMSK0 == 0x08 );
+
+    //Port without PCINT group
+    ConfigTransaction<Portd> trd;
+    trd.EnableInterrupt( 0x01 );
+    trd.Commit();
+    assert( PCMSK0 == 0x08 && PCMSK1 == 0x04 && PCICR == (1 << PCIE1) );
+}
+
+static int changes;
+static bool lastLevel;
+void OnChange(bool level){ changes++; lastLevel = level; }
+
+typedef PinChangeDispatcher< OnPinChange<Pb0, OnChange>, OnPinChange<Pc2Inv, OnChange> > Buttons;
+
+static void TestDispatcher()
+{
+    ResetRegs();
+    Buttons::EnableInterrupts();
+    assert( PCMSK0 == 0x01 && PCMSK1 == 0x04 );
+    assert( PCICR == ((1 << PCIE0) | (1 << PCIE1)) );
+
+    PINC = 0x04;	//Pc2Inv inactive
+    Buttons::Init();
+    PINC = 0;
+    assert( Buttons::Dispatch() == 0x2 );
+    assert( changes == 1 && lastLevel == true );
+
+    Buttons::DisableInterrupts();
+    assert( PCMSK0 == 0 && PCMSK1 == 0 );
+}
+
+int main()
+{
+    TestConfigTransaction();
+    TestDispatcher();
+    printf( "avr_pcint_ram: ok\n" );
+    return 0;
+}
@@ -0,0 +1,145 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Modern AVR(AVRxt) port test against PORT_t and VPORT_t structs in RAM.
+// Checks VPORT single pin and toggle path, OUTSET/OUTCLR multi pin writes and
+// PINCONFIG/PINCTRLUPD/PINCTRLSET/PINCTRLCLR multi pin configuration with PINnCTRL fallback for single pin.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+typedef volatile uint8_t register8_t;
+struct PORT_t
+{
+    register8_t DIR, DIRSET, DIRCLR, DIRTGL, OUT, OUTSET, OUTCLR, OUTTGL, IN, INTFLAGS, PORTCTRL,
+                PINCONFIG, PINCTRLUPD, PINCTRLSET, PINCTRLCLR, reserved,
+                PIN0CTRL, PIN1CTRL, PIN2CTRL, PIN3CTRL, PIN4CTRL, PIN5CTRL, PIN6CTRL, PIN7CTRL;
+};
+struct VPORT_t
+{
+    register8_t DIR, OUT, IN, INTFLAGS;
+};
+PORT_t PORTA, PORTC;
+VPORT_t VPORTA, VPORTC;
+#define PORTA PORTA
+#define PORTC PORTC
+enum
+{
+    PORT_PULLUPEN_bm = 0x08, PORT_INVEN_bm = 0x80, PORT_ISC_gm = 0x07,
+    PORT_ISC_INTDISABLE_gc = 0, PORT_ISC_BOTHEDGES_gc = 1, PORT_ISC_RISING_gc = 2, PORT_ISC_FALLING_gc = 3,
+    PORT_ISC_INPUT_DISABLE_gc = 4, PORT_ISC_LEVEL_gc = 5
+};
+
+#define TRIO_AVRXT_HAS_PINCONFIG 1
+#include "trio.hpp"
+
+using namespace TRIO;
+
+//List bit:   0    1    2       3
+typedef PinList<Pc0, Pc1, Pc2Inv, Pc3> Bus;
+
+static void ResetPorts()
+{
+    memset( (void *)&PORTA, 0, sizeof(PORTA) );
+    memset( (void *)&PORTC, 0, sizeof(PORTC) );
+    memset( (void *)&VPORTA, 0, sizeof(VPORTA) );
+    memset( (void *)&VPORTC, 0, sizeof(VPORTC) );
+}
+
+static void TestWrite()
+{
+    ResetPorts();
+    Pa3::Set();		//SBI on VPORT
+    assert( VPORTA.OUT == 0x08 && PORTA.OUTSET == 0 );
+    Pa3::Clear();
+    assert( VPORTA.OUT == 0 && PORTA.OUTCLR == 0 );
+    Pa3::Toggle();	//writing 1 to VPORT IN
+    assert( VPORTA.IN == 0x08 );
+
+    ResetPorts();
+    Porta::Set<0x30>();
+    assert( PORTA.OUTSET == 0x30 && VPORTA.OUT == 0 );
+    Porta::Clear<0x30>();
+    assert( PORTA.OUTCLR == 0x30 );
+
+    ResetPorts();
+    Bus::Write( 0x5 );	//Pc0 high, Pc2Inv active(low), Pc1 and Pc3 low
+    assert( PORTC.OUTSET == 0x01 );
+    assert( PORTC.OUTCLR == 0x0E );
+    assert( VPORTC.OUT == 0 );
+
+    ResetPorts();
+    Bus::Toggle( 0x3 );
+    assert( VPORTC.IN == 0x03 );
+}
+
+static void TestRead()
+{
+    ResetPorts();
+    VPORTC.IN = 0x06;	//Pc2 high: inverted pin is inactive
+    assert( Bus::Read() == 0x2 );
+}
+
+static void TestConfigure()
+{
+    ResetPorts();
+    Bus::Configure::InPullUp<0xF>();
+    assert( PORTC.DIRCLR == 0x0F );
+    assert( PORTC.PINCONFIG == PORT_PULLUPEN_bm && PORTC.PINCTRLUPD == 0x0F );
+    assert( PORTC.PIN0CTRL == 0 && PORTC.PIN3CTRL == 0 );	//multi pin configuration doesn't touch PINnCTRL
+
+    ResetPorts();
+    Bus::Configure::EnableInterrupt<0xF>();	//whole group, small groups are configured pin by pin
+    assert( PORTC.PINCTRLCLR == 0x0F && PORTC.PINCTRLSET == 0x0F );
+    assert( PORTC.PINCONFIG == PORT_ISC_BOTHEDGES_gc );	//last write: bits to set
+
+    //Single pin goes to its PINnCTRL
+    ResetPorts();
+    PORTC.PIN1CTRL = PORT_PULLUPEN_bm | PORT_ISC_FALLING_gc;
+    Pc1::Configure::EnableInterrupt();
+    assert( PORTC.PIN1CTRL == (PORT_PULLUPEN_bm | PORT_ISC_BOTHEDGES_gc) );
+    assert( PORTC.PINCONFIG == 0 && PORTC.PINCTRLSET == 0 );
+
+    //Runtime masks
+    ResetPorts();
+    Bus::Configure::InAnalog( 0x4 );
+    assert( PORTC.DIRCLR == 0x04 && PORTC.PIN2CTRL == PORT_ISC_INPUT_DISABLE_gc );
+    Bus::Configure::OutPushPull_Fast( 0x9 );
+    assert( PORTC.DIRSET == 0x09 );
+    assert( PORTC.PINCONFIG == PORT_PULLUPEN_bm && PORTC.PINCTRLCLR == 0x09 );
+}
+
+int main()
+{
+    TestWrite();
+    TestRead();
+    TestConfigure();
+    printf( "avrxt_ram: ok\n" );
+    return 0;
+}
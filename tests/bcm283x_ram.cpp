@@ -0,0 +1,118 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// BCM283x port test against GPIO register block in RAM(GpioMem::Attach).
+// Checks GPFSEL fields, GPSET/GPCLR writes and GPLEV reads of a PinList spread over both banks,
+// and BCM2711 pull registers.
+
+#define TRIO_BCM2711
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include "trio.hpp"
+
+using namespace TRIO;
+
+static volatile uint32_t regs[GpioMem::MapSize / 4];
+
+enum{ GPFSEL0 = 0x00 / 4, GPSET0 = 0x1C / 4, GPCLR0 = 0x28 / 4, GPLEV0 = 0x34 / 4, PUP_PDN0 = 0xE4 / 4 };
+
+//List bit:   0    1     2        3    4
+//GPIO:       4    17    30       33   53
+typedef PinList<Pa4, Pa17, Pa30Inv, Pb1, Pb21> Bus;
+
+static void ResetRegs()
+{
+    for( unsigned i = 0; i < GpioMem::MapSize / 4; ++i )
+        regs[i] = 0;
+}
+
+static void TestConfigure()
+{
+    ResetRegs();
+    regs[GPFSEL0 + 3] = 0xFFFFFFFF;
+    Bus::Configure::OutPushPull_Fast<0x1F>();
+    assert( regs[GPFSEL0 + 0] == 1UL << 12 );						//GPIO4
+    assert( regs[GPFSEL0 + 1] == 1UL << 21 );						//GPIO17
+    assert( regs[GPFSEL0 + 2] == 0 );
+    assert( regs[GPFSEL0 + 3] == ((0xFFFFFFFF & ~(7UL | 7UL << 9)) | 1UL | 1UL << 9) );	//GPIO30, GPIO33, others kept
+    assert( regs[GPFSEL0 + 4] == 0 );
+    assert( regs[GPFSEL0 + 5] == 1UL << 9 );						//GPIO53
+
+    //Runtime mask
+    Bus::Configure::InPullUp( 0x3 );	//GPIO4, GPIO17
+    assert( regs[GPFSEL0 + 0] == 0 && regs[GPFSEL0 + 1] == 0 );
+    assert( regs[PUP_PDN0 + 0] == 1UL << 8 );
+    assert( regs[PUP_PDN0 + 1] == 1UL << 2 );
+
+    Bus::Configure::InPullDown<0x10>();	//GPIO53
+    assert( regs[GPFSEL0 + 5] == 0 );
+    assert( regs[PUP_PDN0 + 3] == 2UL << 10 );
+}
+
+static void TestWrite()
+{
+    ResetRegs();
+    Bus::Write( 0x15 );	//GPIO4 high, GPIO17 low, GPIO30 low(inverted), GPIO33 low, GPIO53 high
+    assert( regs[GPSET0 + 0] == 1UL << 4 );
+    assert( regs[GPCLR0 + 0] == (1UL << 17 | 1UL << 30) );
+    assert( regs[GPSET0 + 1] == 1UL << 21 );
+    assert( regs[GPCLR0 + 1] == 1UL << 1 );
+
+    ResetRegs();
+    Pa4::Set();
+    assert( regs[GPSET0] == 1UL << 4 && regs[GPCLR0] == 0 );
+    Pb21::Clear();
+    assert( regs[GPCLR0 + 1] == 1UL << 21 && regs[GPSET0 + 1] == 0 );
+
+    ResetRegs();
+    regs[GPLEV0] = 1UL << 4;
+    Porta::Toggle( 1UL << 4 | 1UL << 5 );
+    assert( regs[GPCLR0] == 1UL << 4 && regs[GPSET0] == 1UL << 5 );
+}
+
+static void TestRead()
+{
+    ResetRegs();
+    regs[GPLEV0 + 0] = 1UL << 17;	//GPIO30 low: inverted pin is active
+    regs[GPLEV0 + 1] = 1UL << 1;
+    assert( Bus::Read() == 0xE );
+    assert( Pa17::IsSet() && !Pa4::IsSet() );
+}
+
+int main()
+{
+    GpioMem::Attach( regs );
+    assert( GpioMem::IsMapped() );
+    TestConfigure();
+    TestWrite();
+    TestRead();
+    GpioMem::Unmap();
+    printf( "bcm283x_ram: ok\n" );
+    return 0;
+}
@@ -0,0 +1,170 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// DynamicPin and DynamicPinSet test on host ports.
+// Checks port lookup by Id with pin number validation, set capacity, grouping of pins by port handle
+// (inverted pins have their own handle), Remove() compacting the set, and Read()/AreAllSet() of inverted pins.
+
+#include "trio.hpp"
+#include <stdio.h>
+#include <assert.h>
+
+using namespace TRIO;
+
+typedef DynamicPorts<Porta, Portb, Portc> BoardPorts;
+
+static void ResetPorts()
+{
+    Porta::Write( 0 );
+    Portb::Write( 0 );
+    Portc::Write( 0 );
+}
+
+static void Loopback()
+{
+    Porta::HWSpecificAPI<>::Loopback();
+    Portb::HWSpecificAPI<>::Loopback();
+    Portc::HWSpecificAPI<>::Loopback();
+}
+
+static void TestPorts()
+{
+    assert( BoardPorts::ById('A') == GetPortHandle<Porta>() );
+    assert( BoardPorts::ById('C') == GetPortHandle<Portc>() );
+    assert( BoardPorts::ById('D') == 0 );		//port exists but is not in BoardPorts
+    assert( !BoardPorts::Pin('Z', 0).IsValid() );
+    assert( !BoardPorts::Pin('D', 0).IsValid() );
+    assert( !BoardPorts::Pin('A', Porta::Width).IsValid() );
+    assert( !BoardPorts::Pin('A', 200).IsValid() );
+
+    const DynamicPin pin = BoardPorts::Pin( 'B', Portb::Width - 1 );
+    assert( pin.IsValid() && pin.Mask == (1UL << (Portb::Width - 1)) );
+    ResetPorts();
+    pin.Set();
+    assert( Portb::ReadOutReg() == (Portb::DataT)(1UL << (Portb::Width - 1)) );
+
+    DynamicPinSet<2> set;
+    assert( !set.Add( DynamicPin() ) );
+    assert( !set.Add( BoardPorts::Pin('A', 200) ) );
+    assert( set.IsEmpty() );
+}
+
+static void TestCapacity()
+{
+    DynamicPinSet<2> set;
+    assert( set.Add( BoardPorts::Pin('A', 0) ) );
+    assert( set.Add( BoardPorts::Pin('B', 1) ) );
+    assert( set.Add( BoardPorts::Pin('A', 2) ) );		//same port: no new entry
+    assert( set.PortsCount() == 2 );
+    assert( !set.Add( BoardPorts::Pin('C', 0) ) );	//full
+    assert( !set.Add( DynamicPin::Of<Pa3Inv>() ) );	//inverted port handle is another entry
+    assert( set.PortsCount() == 2 );
+    assert( !set.Contains( BoardPorts::Pin('C', 0) ) );
+
+    ResetPorts();
+    set.Set();
+    assert( Porta::ReadOutReg() == 0x5 && Portb::ReadOutReg() == 0x2 );
+}
+
+static void TestInvertedGroup()
+{
+    DynamicPinSet<4> set;
+    set.Add( DynamicPin::Of<Pa0>() );
+    set.Add( DynamicPin::Of<Pa1Inv>() );
+    set.Add( DynamicPin::Of<Pa2Inv>() );
+    assert( set.PortsCount() == 2 );
+    assert( set.Contains( DynamicPin::Of<Pa1Inv>() ) );
+    assert( !set.Contains( DynamicPin::Of<Pa1>() ) );
+
+    ResetPorts();
+    Porta::Write( 0x6 );
+    set.Set();		//Pa0 high, Pa1 and Pa2 low
+    assert( Porta::ReadOutReg() == 0x1 );
+    set.Toggle();
+    assert( Porta::ReadOutReg() == 0x6 );
+
+    //Inverted pins are set when line is low
+    Porta::Write( 0x1 );
+    Loopback();
+    assert( set.AreAllSet() );
+    DynamicPinSet<4> high = set.Read();
+    assert( high.PortsCount() == 2 && high.Contains( DynamicPin::Of<Pa2Inv>() ) );
+
+    Porta::Write( 0x5 );	//Pa2Inv inactive
+    Loopback();
+    assert( !set.AreAllSet() && set.IsAnySet() );
+    high = set.Read();
+    assert( high.Contains( DynamicPin::Of<Pa0>() ) && high.Contains( DynamicPin::Of<Pa1Inv>() ) );
+    assert( !high.Contains( DynamicPin::Of<Pa2Inv>() ) );
+
+    Porta::Write( 0x6 );	//nothing is set
+    Loopback();
+    assert( !set.IsAnySet() );
+    assert( set.Read().IsEmpty() );
+}
+
+static void TestRemove()
+{
+    DynamicPinSet<3> set;
+    set.Add( BoardPorts::Pin('A', 0) );
+    set.Add( BoardPorts::Pin('B', 4) );
+    set.Add( BoardPorts::Pin('B', 5) );
+    set.Add( BoardPorts::Pin('C', 7) );
+    assert( set.PortsCount() == 3 );
+
+    set.Remove( BoardPorts::Pin('B', 4) );	//port B still has Pb5
+    assert( set.PortsCount() == 3 );
+    set.Remove( BoardPorts::Pin('B', 5) );
+    assert( set.PortsCount() == 2 );
+    set.Remove( BoardPorts::Pin('B', 5) );	//not in set
+    assert( set.PortsCount() == 2 );
+
+    //Entries after removed one are moved down and still work
+    assert( set.Contains( BoardPorts::Pin('A', 0) ) && set.Contains( BoardPorts::Pin('C', 7) ) );
+    ResetPorts();
+    set.Set();
+    assert( Porta::ReadOutReg() == 0x01 && Portb::ReadOutReg() == 0 && Portc::ReadOutReg() == 0x80 );
+
+    //Freed entry may be used again
+    assert( set.Add( DynamicPin::Of<Pb1Inv>() ) );
+    assert( set.PortsCount() == 3 );
+
+    set.Remove( BoardPorts::Pin('A', 0) );
+    set.Remove( BoardPorts::Pin('C', 7) );
+    set.Remove( DynamicPin::Of<Pb1Inv>() );
+    assert( set.IsEmpty() );
+}
+
+int main()
+{
+    TestPorts();
+    TestCapacity();
+    TestInvertedGroup();
+    TestRemove();
+    printf( "host_dynamic_pins: ok\n" );
+    return 0;
+}
@@ -0,0 +1,142 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// PinChangeDispatcher test on host port, pin changes are made with HWSpecificAPI::DriveInputs().
+// Checks that Init() takes current state without events, handler order and levels for several pins changed
+// at once(count trailing zeros loop), inverted pins, all 32 bindings of full table and EnableInterrupts().
+
+#include "trio.hpp"
+#include <stdio.h>
+#include <assert.h>
+
+using namespace TRIO;
+
+static int calls;
+static int callPin[64];
+static bool callLevel[64];
+
+template< int N >
+void OnPin(bool level)
+{
+    callPin[calls] = N;
+    callLevel[calls] = level;
+    calls++;
+}
+
+//Binding bit:                     0                         1                            2                         3
+typedef PinChangeDispatcher< OnPinChange<Pa3, OnPin<0> >, OnPinChange<Pa1Inv, OnPin<1> >, OnPinChange<Pb0, OnPin<2> >, OnPinChange<Pa0, OnPin<3> > > Buttons;
+
+#define TRIO_TEST_BIND(PIN, N)	OnPinChange<PIN, OnPin<N> >
+typedef PinChangeDispatcher<
+    TRIO_TEST_BIND(Pa0, 0),   TRIO_TEST_BIND(Pa1, 1),   TRIO_TEST_BIND(Pa2, 2),   TRIO_TEST_BIND(Pa3, 3),
+    TRIO_TEST_BIND(Pa4, 4),   TRIO_TEST_BIND(Pa5, 5),   TRIO_TEST_BIND(Pa6, 6),   TRIO_TEST_BIND(Pa7, 7),
+    TRIO_TEST_BIND(Pa8, 8),   TRIO_TEST_BIND(Pa9, 9),   TRIO_TEST_BIND(Pa10, 10), TRIO_TEST_BIND(Pa11, 11),
+    TRIO_TEST_BIND(Pa12, 12), TRIO_TEST_BIND(Pa13, 13), TRIO_TEST_BIND(Pa14, 14), TRIO_TEST_BIND(Pa15, 15),
+    TRIO_TEST_BIND(Pb0, 16),  TRIO_TEST_BIND(Pb1, 17),  TRIO_TEST_BIND(Pb2, 18),  TRIO_TEST_BIND(Pb3, 19),
+    TRIO_TEST_BIND(Pb4, 20),  TRIO_TEST_BIND(Pb5, 21),  TRIO_TEST_BIND(Pb6, 22),  TRIO_TEST_BIND(Pb7, 23),
+    TRIO_TEST_BIND(Pb8, 24),  TRIO_TEST_BIND(Pb9, 25),  TRIO_TEST_BIND(Pb10, 26), TRIO_TEST_BIND(Pb11, 27),
+    TRIO_TEST_BIND(Pb12, 28), TRIO_TEST_BIND(Pb13, 29), TRIO_TEST_BIND(Pb14, 30), TRIO_TEST_BIND(Pb15Inv, 31) > AllPins;
+#undef TRIO_TEST_BIND
+
+static void DriveInputs(Porta::DataT a, Portb::DataT b)
+{
+    Porta::HWSpecificAPI<>::DriveInputs( a );
+    Portb::HWSpecificAPI<>::DriveInputs( b );
+}
+
+static void TestInit()
+{
+    DriveInputs( 0x0008, 0 );	//Pa3 high, Pa1 low: Pa1Inv active
+    Buttons::Init();
+    assert( Buttons::State() == 0x3 );
+    calls = 0;
+    assert( Buttons::Dispatch() == 0 );
+    assert( calls == 0 );
+}
+
+static void TestSimultaneousChanges()
+{
+    DriveInputs( 0x000B, 0x0001 );	//Pa1Inv released, Pa0 and Pb0 pressed at once, Pa3 still high
+    calls = 0;
+    assert( Buttons::Dispatch() == 0xE );
+    assert( calls == 3 );
+    assert( callPin[0] == 1 && callLevel[0] == false );
+    assert( callPin[1] == 2 && callLevel[1] == true );
+    assert( callPin[2] == 3 && callLevel[2] == true );
+
+    //Nothing changed
+    calls = 0;
+    assert( Buttons::Dispatch() == 0 );
+    assert( calls == 0 );
+
+    //Other port pins are not bound
+    DriveInputs( 0x00FB, 0xFF01 );
+    assert( Buttons::Dispatch() == 0 );
+    assert( calls == 0 );
+}
+
+static void TestEnableInterrupts()
+{
+    Buttons::EnableInterrupts();
+    assert( Porta::HWSpecificAPI<>::GetGPIORegsReference().IRQ.load() == 0x000B );
+    assert( Portb::HWSpecificAPI<>::GetGPIORegsReference().IRQ.load() == 0x0001 );
+    Buttons::DisableInterrupts();
+    assert( Porta::HWSpecificAPI<>::GetGPIORegsReference().IRQ.load() == 0 );
+    assert( Portb::HWSpecificAPI<>::GetGPIORegsReference().IRQ.load() == 0 );
+}
+
+static void TestFullTable()
+{
+    BOOST_STATIC_ASSERT( sizeof(AllPins::DataT) == 4 );
+    DriveInputs( 0, 0x8000 );	//Pb15Inv inactive
+    AllPins::Init();
+    assert( AllPins::State() == 0 );
+
+    DriveInputs( 0xFFFF, 0x0001 );	//all port A pins and Pb0 high, Pb15Inv active
+    calls = 0;
+    assert( AllPins::Dispatch() == 0x8001FFFFUL );
+    assert( calls == 18 );
+    for( int i = 0; i < 17; i++ )
+        assert( callPin[i] == i && callLevel[i] == true );
+    assert( callPin[17] == 31 && callLevel[17] == true );
+
+    //Top bit alone
+    DriveInputs( 0xFFFF, 0x8001 );
+    calls = 0;
+    assert( AllPins::Dispatch() == 0x80000000UL );
+    assert( calls == 1 && callPin[0] == 31 && callLevel[0] == false );
+}
+
+int main()
+{
+    TestInit();
+    TestSimultaneousChanges();
+    TestEnableInterrupts();
+    TestFullTable();
+    printf( "host_pin_change: ok\n" );
+    return 0;
+}
@@ -0,0 +1,150 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// PinList planner test on 8 bit host ports.
+// Nested PinLists are flattened into one PinList wider than a port: serial groups above port width must be
+// written and read, compile time Configure<MASK> must touch only masked pins also in small groups(less than
+// Settings::ConfGrSizeMetric pins of a port). SubList, Concat and Field make PinLists of existing pins.
+
+#define TRIO_HOST_PORT_WIDTH 8
+#include "trio.hpp"
+#include <stdio.h>
+#include <assert.h>
+
+using namespace TRIO;
+
+typedef PinList<Pa0, Pa1, Pa2, Pa3, Pb0, Pb1, Pb2, Pa7> Low;	//bits 0..7
+typedef PinList<Pa4, Pa5, Pa6, Pb5Inv> High;					//bits 8..11, Pa4..Pa6 is a serial group above port width
+typedef PinList<Low, High, Pc1, Pc2> Bus;						//Pc1, Pc2 are bits 12, 13
+
+BOOST_STATIC_ASSERT( Bus::Length == 14 );
+BOOST_STATIC_ASSERT( sizeof(Bus::DataT) == 2 );
+BOOST_STATIC_ASSERT( (PinList<Portd, Pa0>::Length == 9) );
+
+static void ResetPorts()
+{
+    Porta::Write( 0 );
+    Portb::Write( 0 );
+    Portc::Write( 0 );
+    Porta::Configure::InFloating<0xFF>();
+    Portb::Configure::InFloating<0xFF>();
+    Portc::Configure::InFloating<0xFF>();
+}
+
+static void Loopback()
+{
+    Porta::HWSpecificAPI<>::Loopback();
+    Portb::HWSpecificAPI<>::Loopback();
+    Portc::HWSpecificAPI<>::Loopback();
+}
+
+static uint8_t Dir(uint8_t port)
+{
+    switch( port )
+    {
+    case 'A': return Porta::HWSpecificAPI<>::GetGPIORegsReference().DIR.load();
+    case 'B': return Portb::HWSpecificAPI<>::GetGPIORegsReference().DIR.load();
+    default:  return Portc::HWSpecificAPI<>::GetGPIORegsReference().DIR.load();
+    }
+}
+
+static void TestWrite()
+{
+    ResetPorts();
+    Bus::Write( 0x3FFF );	//Pb5Inv active: line low
+    assert( Porta::ReadOutReg() == 0xFF );
+    assert( Portb::ReadOutReg() == 0x07 );
+    assert( Portc::ReadOutReg() == 0x06 );
+    Loopback();
+    assert( Bus::Read() == 0x3FFF );
+
+    Bus::Write( 0x0700 );	//only serial group above port width, Pb5Inv inactive: line high
+    assert( Porta::ReadOutReg() == 0x70 );
+    assert( Portb::ReadOutReg() == 0x20 );
+    assert( Portc::ReadOutReg() == 0 );
+    Loopback();
+    assert( Bus::Read() == 0x0700 );
+
+    Bus::Write( 0x0550 );	//Pb0, Pb2, Pa4, Pa6
+    assert( Porta::ReadOutReg() == 0x50 && Portb::ReadOutReg() == 0x25 );
+}
+
+static void TestConfigure()
+{
+    ResetPorts();
+    Bus::Configure::OutPushPull_Fast<(1 << 12)>();	//Pc1 only, Pc2 is in the same small group
+    assert( Dir('C') == 0x02 );
+    assert( Dir('A') == 0 && Dir('B') == 0 );
+
+    Bus::Configure::OutPushPull_Fast<(1 << 7) | (1 << 11)>();	//Pa7 and Pb5Inv
+    assert( Dir('A') == 0x80 && Dir('B') == 0x20 && Dir('C') == 0x02 );
+
+    Bus::Configure::OutPushPull_Fast<0x0F00>();	//Pa4..Pa6 by mask and Pb5Inv
+    assert( Dir('A') == 0xF0 && Dir('B') == 0x20 );
+
+    Bus::Configure::InFloating<(1 << 8)>();
+    assert( Dir('A') == 0xE0 );
+}
+
+static void TestSlicing()
+{
+    typedef SubList<Bus, 4, 6>::Result PortbLow;	//Pb0..Pb2
+    BOOST_STATIC_ASSERT( PortbLow::Length == 3 );
+    ResetPorts();
+    Portb::Write( 0xF0 );
+    PortbLow::Write( 0x5 );
+    assert( Portb::ReadOutReg() == 0xF5 );
+    assert( Porta::ReadOutReg() == 0 );
+
+    typedef Concat< SubList<Bus, 0, 3>::Result, PinList<Pc1> >::Result Addr;	//Pa0..Pa3, Pc1
+    BOOST_STATIC_ASSERT( Addr::Length == 5 );
+    ResetPorts();
+    Addr::Write( 0x1A );
+    assert( Porta::ReadOutReg() == 0x0A && Portc::ReadOutReg() == 0x02 );
+
+    typedef Field<Bus, 8, 3> Cmd;	//Pa4..Pa6
+    BOOST_STATIC_ASSERT( Cmd::Length == 3 );
+    ResetPorts();
+    Porta::Write( 0x8F );
+    Cmd::Write( 0x5 );
+    assert( Porta::ReadOutReg() == 0xDF );
+    Bus::WriteField<8, 3>( 0x2 );
+    assert( Porta::ReadOutReg() == 0xAF );
+    Loopback();
+    assert( Cmd::Read() == 0x2 );
+    assert( (Bus::ReadField<8, 3>() == 0x2) );
+    assert( (Bus::ReadField<0, 4>() == 0xF) );
+}
+
+int main()
+{
+    TestWrite();
+    TestConfigure();
+    TestSlicing();
+    printf( "host_pinlist: ok\n" );
+    return 0;
+}
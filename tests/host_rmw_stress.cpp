@@ -0,0 +1,105 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Host port stress test of TRIO_RMW_LOCKFREE(see trio_atomic.hpp).
+// Two threads Set/Toggle/Clear their own halves of Porta at the same time. Every round must end with
+// each thread's last written state: with plain read-modify-write(TRIO_RMW_NONE) some rounds lose
+// updates of the other thread, lock-free policy must lose none.
+// Second stress round does the same through PinLists with inverted pins, so writes go through PinList mapping
+// to one port ClearAndSet. Test returns nonzero if any round lost updates.
+
+#define TRIO_RMW_POLICY TRIO_RMW_LOCKFREE
+#include "trio.hpp"
+#include <thread>
+#include <stdio.h>
+
+using namespace TRIO;
+
+static const int Rounds = 200;
+static const int Iterations = 1000;
+
+//Porta halves, one inverted pin in each
+typedef PinList<Pa0, Pa1Inv, Pa2, Pa3, Pa4, Pa5, Pa6, Pa7> LowPins;
+typedef PinList<Pa8, Pa9, Pa10, Pa11, Pa12, Pa13, Pa14, Pa15Inv> HighPins;
+
+static void PortWorker(Porta::DataT mask)
+{
+    for( int i = 0; i < Iterations; i++ )
+    {
+        Porta::Set( mask );
+        Porta::Toggle( mask );	//cleared
+        Porta::Toggle( mask );	//set
+        Porta::Clear( mask );
+        Porta::Set( mask );
+    }
+}
+
+template< class PINS >
+static void PinListWorker()
+{
+    for( int i = 0; i < Iterations; i++ )
+    {
+        PINS::Set( 0xFF );
+        PINS::Clear( 0xFF );
+        PINS::ClearAndSet( 0xFF, 0x0F );
+        PINS::Set( 0xFF );
+    }
+}
+
+//Returns number of rounds which didn't end with EXPECTED output register
+template< class WORKER_A, class WORKER_B >
+static int StressRounds(WORKER_A a, WORKER_B b, Porta::DataT expected)
+{
+    int lostRounds = 0;
+    for( int round = 0; round < Rounds; round++ )
+    {
+        Porta::Write( 0 );
+        std::thread ta( a );
+        std::thread tb( b );
+        ta.join();
+        tb.join();
+        if( Porta::ReadOutReg() != expected )
+            lostRounds++;
+    }
+    return lostRounds;
+}
+
+int main()
+{
+    const Porta::DataT low = (Porta::DataT)( (1U << (Porta::Width / 2)) - 1 );
+    const Porta::DataT high = (Porta::DataT)~low;
+
+    const int portLost = StressRounds( [=]{ PortWorker( low ); }, [=]{ PortWorker( high ); }, (Porta::DataT)(low | high) );
+    printf( "host_rmw_stress: port %d/%d rounds lost updates\n", portLost, Rounds );
+
+    //Set of all pins drives inverted pins low
+    const Porta::DataT pinsSet = (Porta::DataT)~( (1U << 1) | (1U << 15) );
+    const int pinListLost = StressRounds( PinListWorker<LowPins>, PinListWorker<HighPins>, pinsSet );
+    printf( "host_rmw_stress: PinList %d/%d rounds lost updates\n", pinListLost, Rounds );
+
+    return ( portLost == 0 && pinListLost == 0 ) ? 0 : 1;
+}
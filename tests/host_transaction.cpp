@@ -0,0 +1,109 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Transaction test on host port.
+// Checks that nothing is written before Commit(), that Commit() applies clear and set of all members
+// of a port together, inverted members, last staged write of a member winning, Cancel(), and compile time
+// detection of pins shared by members.
+
+#include "trio.hpp"
+#include <stdio.h>
+#include <assert.h>
+
+using namespace TRIO;
+
+//Transaction bit:   0    1    2    3
+typedef PinList<Pa0, Pa1, Pa2, Pa3> Data;
+typedef Pa4 Rs;
+typedef Pa5Inv E;		//active low strobe
+typedef Transaction<Data, Rs, E, Pb2> LcdTransaction;
+
+//Transaction<PinList<Pa0, Pa1>, Pa1> must not compile: Pa1 would have two staged bits
+BOOST_STATIC_ASSERT( (Private::TransactionSharedPins< Private::PinListElementPins< PinList<PinList<Pa0, Pa1>, Pa1> >::Result >::value) );
+BOOST_STATIC_ASSERT( (Private::TransactionSharedPins< Private::PinListElementPins< PinList<Pa1, Pa1Inv> >::Result >::value) );
+BOOST_STATIC_ASSERT( !(Private::TransactionSharedPins< Private::PinListElementPins< LcdTransaction::Pins >::Result >::value) );
+BOOST_STATIC_ASSERT( !(Private::TransactionSharedPins< Private::PinListElementPins< PinList<Pa1, Pb1> >::Result >::value) );
+
+static void TestCommit()
+{
+    Porta::Write( 0x00F0 );
+    Portb::Write( 0x0004 );
+
+    LcdTransaction tr;
+    tr.Write<Data>( 0x5 );
+    tr.Set<Rs>();
+    tr.Set<E>();		//line low
+    tr.Clear<Pb2>();
+    assert( Porta::ReadOutReg() == 0x00F0 && Portb::ReadOutReg() == 0x0004 );	//staged only
+
+    tr.Commit();
+    assert( Porta::ReadOutReg() == 0x00D5 );	//Pa0..3 = 0101, Pa4 high, Pa5 low, Pa6 and Pa7 untouched
+    assert( Portb::ReadOutReg() == 0 );
+
+    //Commit drops staged writes: nothing is written again
+    Porta::Write( 0 );
+    tr.Commit();
+    assert( Porta::ReadOutReg() == 0 );
+
+    //Not staged member pins are not touched
+    Porta::Write( 0x0020 );
+    tr.Set<Data>( 0x2 );
+    tr.Commit();
+    assert( Porta::ReadOutReg() == 0x0022 );
+}
+
+static void TestLastWriteWins()
+{
+    Porta::Write( 0 );
+    LcdTransaction tr;
+    tr.Write<Data>( 0xF );
+    tr.Clear<Data>( 0x3 );
+    tr.Set<E>();
+    tr.Clear<E>();		//line high
+    tr.Commit();
+    assert( Porta::ReadOutReg() == 0x002C );
+}
+
+static void TestCancel()
+{
+    Porta::Write( 0x000F );
+    LcdTransaction tr;
+    tr.Write<Data>( 0 );
+    tr.Set<Rs>();
+    tr.Cancel();
+    tr.Commit();
+    assert( Porta::ReadOutReg() == 0x000F );
+}
+
+int main()
+{
+    TestCommit();
+    TestLastWriteWins();
+    TestCancel();
+    printf( "host_transaction: ok\n" );
+    return 0;
+}
@@ -0,0 +1,248 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Linux GPIO character device port test against fake gpiochip(TRIO_LINUX_GPIO_DRIVER).
+// Checks one GPIO_V2_LINE_SET_VALUES_IOCTL per PinList write, bits/mask mapping to line request indexes
+// with inverted pins, GPIO_V2_LINE_GET_VALUES_IOCTL mapping back to PinList bits and re-request of the port
+// when new lines are configured. Fake chip rejects SET_VALUES with input lines in mask, as kernel does.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <linux/gpio.h>
+#include <sys/types.h>
+
+//Fake chip keeps line values in line request bit order, like kernel does
+struct FakeChip
+{
+    static int requests;        //GPIO_V2_GET_LINE_IOCTL count
+    static int setConfigs;      //GPIO_V2_LINE_SET_CONFIG_IOCTL count
+    static int setValues;       //GPIO_V2_LINE_SET_VALUES_IOCTL count
+    static int closes;
+    static gpio_v2_line_request lastRequest;
+    static gpio_v2_line_values lastSet;
+    static uint64_t lastGetMask;
+    static uint64_t values;
+    static uint64_t outputLines;	//request bits of output lines
+
+    static bool IsOutput(uint64_t flags){ return (flags & GPIO_V2_LINE_FLAG_OUTPUT) != 0; }
+    //Lines not covered by flag attributes take config.flags
+    static uint64_t OutputLines(const gpio_v2_line_config &config, uint32_t numLines)
+    {
+        uint64_t all = numLines >= 64 ? ~(uint64_t)0 : (((uint64_t)1 << numLines) - 1);
+        uint64_t output = 0, covered = 0;
+        for( unsigned i = 0; i < config.num_attrs; ++i )
+        {
+            if( config.attrs[i].attr.id != GPIO_V2_LINE_ATTR_ID_FLAGS )
+                continue;
+            covered |= config.attrs[i].mask;
+            if( IsOutput( config.attrs[i].attr.flags ) )
+                output |= config.attrs[i].mask;
+        }
+        if( IsOutput( config.flags ) )
+            output |= all & ~covered;
+        return output;
+    }
+
+    static int Open(const char *){ return 3; }
+    static int Close(int){ ++closes; return 0; }
+    static ssize_t Read(int, void *, size_t){ return 0; }
+    static int Ioctl(int, unsigned long request, void *arg)
+    {
+        switch( request )
+        {
+        case GPIO_V2_GET_LINE_IOCTL:
+            ++requests;
+            lastRequest = *(gpio_v2_line_request *)arg;
+            ((gpio_v2_line_request *)arg)->fd = 10 + requests;
+            outputLines = OutputLines( lastRequest.config, lastRequest.num_lines );
+            return 0;
+        case GPIO_V2_LINE_SET_CONFIG_IOCTL:
+            ++setConfigs;
+            outputLines = OutputLines( *(gpio_v2_line_config *)arg, lastRequest.num_lines );
+            return 0;
+        case GPIO_V2_LINE_SET_VALUES_IOCTL:
+        {
+            ++setValues;
+            lastSet = *(gpio_v2_line_values *)arg;
+            if( lastSet.mask & ~outputLines )
+            {
+                errno = EPERM;
+                return -1;
+            }
+            values = (values & ~lastSet.mask) | (lastSet.bits & lastSet.mask);
+            return 0;
+        }
+        case GPIO_V2_LINE_GET_VALUES_IOCTL:
+        {
+            gpio_v2_line_values *v = (gpio_v2_line_values *)arg;
+            lastGetMask = v->mask;
+            v->bits = values & v->mask;
+            return 0;
+        }
+        }
+        errno = EINVAL;
+        return -1;
+    }
+};
+int FakeChip::requests;
+int FakeChip::setConfigs;
+int FakeChip::setValues;
+int FakeChip::closes;
+gpio_v2_line_request FakeChip::lastRequest;
+gpio_v2_line_values FakeChip::lastSet;
+uint64_t FakeChip::lastGetMask;
+uint64_t FakeChip::values;
+uint64_t FakeChip::outputLines;
+
+#define TRIO_LINUX_GPIO_DRIVER FakeChip
+#include "trio.hpp"
+
+using namespace TRIO;
+
+//List bit:   0    1       2
+typedef PinList<Pa4, Pa5Inv, Pa20> Bus;
+
+static void TestRequest()
+{
+    Bus::Configure::OutPushPull_Fast<0x7>();
+    assert( FakeChip::requests == 1 );
+    assert( FakeChip::lastRequest.num_lines == 3 );
+    assert( FakeChip::lastRequest.offsets[0] == 4 && FakeChip::lastRequest.offsets[1] == 5 && FakeChip::lastRequest.offsets[2] == 20 );
+    assert( FakeChip::lastRequest.config.flags == GPIO_V2_LINE_FLAG_OUTPUT );
+    assert( Porta::HWSpecificAPI<>::GetRequestFd() == 11 );
+}
+
+static void TestWrite()
+{
+    FakeChip::setValues = 0;
+    Bus::Write( 0x3 );	//Pa4 high, Pa5Inv active(line low), Pa20 low
+    assert( FakeChip::setValues == 1 );
+    assert( FakeChip::lastSet.mask == 0x7 );	//request indexes 0, 1, 2
+    assert( FakeChip::lastSet.bits == 0x1 );
+    assert( Porta::ReadOutReg() == (1UL << 4) );
+
+    FakeChip::setValues = 0;
+    Bus::Set( 0x4 );	//Pa20
+    assert( FakeChip::setValues == 1 );
+    assert( FakeChip::lastSet.mask == 0x4 && FakeChip::lastSet.bits == 0x4 );
+
+    FakeChip::setValues = 0;
+    Bus::Clear( 0x2 );	//Pa5Inv inactive: line high
+    assert( FakeChip::setValues == 1 );
+    assert( FakeChip::lastSet.mask == 0x2 && FakeChip::lastSet.bits == 0x2 );
+
+    FakeChip::setValues = 0;
+    Pa7::Set();	//not requested line is ignored
+    assert( FakeChip::setValues == 0 );
+}
+
+static void TestRead()
+{
+    FakeChip::values = 0x6;	//lines 5 and 20 high
+    assert( Bus::Read() == 0x4 );	//Pa5Inv is inactive when line is high
+    assert( FakeChip::lastGetMask == 0x7 );
+    FakeChip::values = 0x1;	//line 4 high
+    assert( Bus::Read() == 0x3 );
+}
+
+static void TestReRequest()
+{
+    //Already requested line: SET_CONFIG only
+    Pa4::Configure::OutOpenDrain_Fast();
+    assert( FakeChip::requests == 1 && FakeChip::setConfigs == 1 );
+
+    //New line: port is requested again with all lines and current outputs
+    const int closes = FakeChip::closes;
+    Pa7::Configure::InPullUp();
+    assert( FakeChip::requests == 2 );
+    assert( FakeChip::closes == closes + 1 );
+    assert( FakeChip::lastRequest.num_lines == 4 );
+    assert( FakeChip::lastRequest.offsets[2] == 7 && FakeChip::lastRequest.offsets[3] == 20 );
+    assert( Porta::HWSpecificAPI<>::GetRequestFd() == 12 );
+
+    bool outputsFound = false;
+    const gpio_v2_line_config &config = FakeChip::lastRequest.config;
+    for( unsigned i = 0; i < config.num_attrs; ++i )
+    {
+        if( config.attrs[i].attr.id != GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES )
+            continue;
+        outputsFound = true;
+        assert( config.attrs[i].mask == 0xB );				//lines 4, 5, 20
+        assert( config.attrs[i].attr.values == 0xB );		//all high after TestWrite
+    }
+    assert( outputsFound );
+
+    //Pa20 moved to request index 3
+    FakeChip::setValues = 0;
+    Bus::Write( 0x4 );
+    assert( FakeChip::setValues == 1 );
+    assert( FakeChip::lastSet.mask == 0xB && FakeChip::lastSet.bits == 0xA );
+}
+
+static void TestWriteWithInputLine()
+{
+    //Pa7 is input: whole port write must skip it, otherwise kernel rejects the call
+    Porta::HWSpecificAPI<>::ClearError();
+    FakeChip::setValues = 0;
+    Porta::Write( 1UL << 4 );
+    assert( FakeChip::setValues == 1 );
+    assert( Porta::HWSpecificAPI<>::LastError() == 0 );
+    assert( FakeChip::lastSet.mask == 0xB && FakeChip::lastSet.bits == 0x1 );	//request indexes 0, 1, 3
+    assert( Porta::ReadOutReg() == (1UL << 4) );
+
+    //Input line only: nothing to write
+    FakeChip::setValues = 0;
+    Pa7::Set();
+    assert( FakeChip::setValues == 0 );
+
+    //Input becomes output and may be written
+    Pa7::Configure::OutPushPull_Fast();
+    Pa7::Set();
+    assert( FakeChip::setValues == 1 && Porta::HWSpecificAPI<>::LastError() == 0 );
+    assert( FakeChip::lastSet.mask == 0x4 && FakeChip::lastSet.bits == 0x4 );
+
+    //Output becomes input and is not written anymore
+    Pa4::Configure::InFloating();
+    FakeChip::setValues = 0;
+    Porta::Write( 0 );
+    assert( FakeChip::setValues == 1 && Porta::HWSpecificAPI<>::LastError() == 0 );
+    assert( FakeChip::lastSet.mask == 0xE && FakeChip::lastSet.bits == 0 );
+}
+
+int main()
+{
+    TestRequest();
+    TestWrite();
+    TestRead();
+    TestReRequest();
+    TestWriteWithInputLine();
+    printf( "linux_fake_chip: ok\n" );
+    return 0;
+}
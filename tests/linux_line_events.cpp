@@ -0,0 +1,137 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// LineEventReader(Linux/trio_line_events.hpp) test against fake edge event source(TRIO_LINUX_GPIO_DRIVER).
+// Checks counting of lost events by sequence number gaps, edge swapping of inverted pins,
+// dropping of events of lines that are not in PinList and reads limited by free ring space.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <linux/gpio.h>
+#include <sys/types.h>
+
+//Fake chip returns queued events from read() of line request fd
+struct FakeEventSource
+{
+    static gpio_v2_line_event queue[64];
+    static unsigned queued;
+    static unsigned reads;
+
+    static int Open(const char *){ return 3; }
+    static int Close(int){ return 0; }
+    static int Ioctl(int, unsigned long request, void *arg)
+    {
+        if( request == GPIO_V2_GET_LINE_IOCTL )
+            ((gpio_v2_line_request *)arg)->fd = 10;
+        return 0;
+    }
+    static ssize_t Read(int, void *buf, size_t count)
+    {
+        ++reads;
+        unsigned n = (unsigned)(count / sizeof(gpio_v2_line_event));
+        if( n > queued )
+            n = queued;
+        memcpy( buf, queue, n * sizeof(queue[0]) );
+        memmove( queue, queue + n, (queued - n) * sizeof(queue[0]) );
+        queued -= n;
+        return (ssize_t)(n * sizeof(queue[0]));
+    }
+
+    static void Push(uint32_t line, bool rising, uint64_t timestampNs, uint32_t seqno)
+    {
+        gpio_v2_line_event &e = queue[queued++];
+        memset( &e, 0, sizeof(e) );
+        e.offset = line;
+        e.id = rising ? GPIO_V2_LINE_EVENT_RISING_EDGE : GPIO_V2_LINE_EVENT_FALLING_EDGE;
+        e.timestamp_ns = timestampNs;
+        e.seqno = seqno;
+    }
+};
+gpio_v2_line_event FakeEventSource::queue[64];
+unsigned FakeEventSource::queued;
+unsigned FakeEventSource::reads;
+
+#define TRIO_LINUX_GPIO_DRIVER FakeEventSource
+#include "trio.hpp"
+
+using namespace TRIO;
+
+//List bit:   0    1    2
+typedef PinList<Pa4, Pa5, Pa17Inv> Sensors;
+typedef LineEventReader<Sensors, 4> Reader;
+
+int main()
+{
+    Sensors::Configure::InPullUp<0x7>();
+    Sensors::Configure::EnableInterrupt<0x7>();
+    Reader reader;
+
+    FakeEventSource::Push( 5, true, 100, 1 );
+    FakeEventSource::Push( 17, true, 200, 2 );	//inverted pin: line rising is pin falling
+    FakeEventSource::Push( 9, true, 250, 3 );	//line is not in PinList
+    FakeEventSource::Push( 4, false, 300, 6 );	//seqno 4 and 5 are lost
+    FakeEventSource::Push( 17, false, 400, 7 );
+    FakeEventSource::Push( 4, true, 500, 8 );
+
+    //Only 4 events fit into ring, one is dropped as foreign line
+    assert( reader.Fill() == 3 );
+    assert( FakeEventSource::reads == 1 );
+    assert( reader.Count() == 3 );
+    assert( reader.Lost() == 2 );
+
+    Reader::Event ev;
+    assert( reader.Pop(ev) && ev.rising == 0x2 && ev.falling == 0 && ev.timestampNs == 100 && ev.seqno == 1 );
+    assert( reader.Pop(ev) && ev.rising == 0 && ev.falling == 0x4 && ev.timestampNs == 200 );
+    assert( reader.Pop(ev) && ev.rising == 0 && ev.falling == 0x1 && ev.timestampNs == 300 );
+    assert( !reader.Pop(ev) );
+
+    //Rest of events, no gaps
+    assert( reader.Fill() == 2 );
+    assert( reader.Lost() == 2 );
+    Reader::Event events[4];
+    assert( reader.Pop( events, 4 ) == 2 );
+    assert( events[0].rising == 0x4 && events[0].falling == 0 && events[0].timestampNs == 400 );	//inverted: line falling is pin rising
+    assert( events[1].rising == 0x1 && events[1].timestampNs == 500 );
+
+    //Gap across reads is counted too
+    FakeEventSource::Push( 5, false, 600, 12 );
+    assert( reader.Fill() == 1 );
+    assert( reader.Lost() == 5 );
+
+    //Port that is not ready is not read
+    struct pollfd fds[Reader::PortsCount];
+    assert( reader.GetPollFds(fds) == 1 && fds[0].fd == 10 );
+    fds[0].revents = 0;
+    const unsigned reads = FakeEventSource::reads;
+    assert( reader.Fill(fds) == 0 && FakeEventSource::reads == reads );
+
+    printf( "linux_line_events: ok\n" );
+    return 0;
+}
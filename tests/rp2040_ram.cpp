@@ -0,0 +1,129 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// RP2040 SIO port test against register blocks in RAM(TRIO_RP2040_xxx_BASE).
+// Checks GPIO_OUT_SET/CLR/XOR and GPIO_OE_SET writes, pad and function select of configured pins
+// and PROC0_INTE bits written through atomic SET/CLR aliases.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+static uint32_t sio[16];
+static uint32_t ioBank[0x1000];	//atomic aliases are at +0x2000 and +0x3000 bytes
+static uint32_t pads[0x1000];
+#define TRIO_RP2040_SIO_BASE ((uintptr_t)sio)
+#define TRIO_RP2040_IO_BANK0_BASE ((uintptr_t)ioBank)
+#define TRIO_RP2040_PADS_BANK0_BASE ((uintptr_t)pads)
+
+#include "trio.hpp"
+
+using namespace TRIO;
+
+enum{ GPIO_IN = 1, GPIO_OUT = 4, GPIO_OUT_SET = 5, GPIO_OUT_CLR = 6, GPIO_OUT_XOR = 7, GPIO_OE_SET = 9, GPIO_OE_CLR = 10 };
+enum{ GPIO0_CTRL = 1, PROC0_INTE0 = 0x40, GPIO0_PAD = 1, ALIAS_SET = 0x800, ALIAS_CLR = 0xC00 };
+
+//List bit:   0    1    2    3        4     5
+typedef PinList<Pa0, Pa1, Pa2, Pa29Inv, Pa10, Pa12> Bus;
+static const uint32_t BusPins = 1UL << 0 | 1UL << 1 | 1UL << 2 | 1UL << 29 | 1UL << 10 | 1UL << 12;
+
+static void ResetRegs()
+{
+    memset( sio, 0, sizeof(sio) );
+    memset( ioBank, 0, sizeof(ioBank) );
+    memset( pads, 0, sizeof(pads) );
+}
+
+static void TestWrite()
+{
+    ResetRegs();
+    Bus::Set( 0x01 );
+    assert( sio[GPIO_OUT_SET] == 1UL && sio[GPIO_OUT_CLR] == 0 );
+
+    ResetRegs();
+    Bus::Set( 0x08 );	//inverted pin: line is cleared
+    assert( sio[GPIO_OUT_CLR] == 1UL << 29 && sio[GPIO_OUT_SET] == 0 );
+
+    ResetRegs();
+    Bus::Clear( 0x10 );
+    assert( sio[GPIO_OUT_CLR] == 1UL << 10 && sio[GPIO_OUT_SET] == 0 );
+
+    ResetRegs();
+    Bus::Toggle( 0x30 );
+    assert( sio[GPIO_OUT_XOR] == (1UL << 10 | 1UL << 12) );
+
+    ResetRegs();
+    Bus::Write( 0x03 );	//Pa0, Pa1 high, Pa29Inv inactive(line high), others low
+    assert( sio[GPIO_OUT_SET] == (1UL << 0 | 1UL << 1 | 1UL << 29) );
+    assert( sio[GPIO_OUT_CLR] == (1UL << 2 | 1UL << 10 | 1UL << 12) );
+    assert( sio[GPIO_OUT] == 0 );	//other port pins are not written
+}
+
+static void TestRead()
+{
+    ResetRegs();
+    sio[GPIO_IN] = 1UL << 0 | 1UL << 2 | 1UL << 12;	//Pa29 low: inverted pin is active
+    assert( Bus::Read() == 0x2D );
+}
+
+static void TestConfigure()
+{
+    ResetRegs();
+    Bus::Configure::OutPushPull_Fast<0x3F>();
+    assert( sio[GPIO_OE_SET] == BusPins );
+    for( unsigned pin = 0; pin < 30; ++pin )
+    {
+        const bool used = (BusPins >> pin) & 1;
+        assert( ioBank[GPIO0_CTRL + pin * 2] == (used ? 5UL : 0) );								//SIO function
+        assert( pads[ALIAS_SET + GPIO0_PAD + pin] == (used ? (0x40UL | 0x30UL | 0x1UL) : 0) );		//IE, 12mA, fast slew
+        assert( pads[ALIAS_CLR + GPIO0_PAD + pin] == (used ? (0x80UL | 0x08UL | 0x04UL | 0x30UL | 0x01UL) : 0) );
+    }
+
+    ResetRegs();
+    Bus::Configure::InPullUp( 0x04 );	//Pa2
+    assert( sio[GPIO_OE_CLR] == 1UL << 2 );
+    assert( pads[ALIAS_SET + GPIO0_PAD + 2] == (0x40UL | 0x08UL) );
+
+    ResetRegs();
+    Bus::Configure::EnableInterrupt<0x31>();	//GPIO0, GPIO10, GPIO12: both edges
+    assert( ioBank[ALIAS_SET + PROC0_INTE0 + 0] == 0xCUL );
+    assert( ioBank[ALIAS_SET + PROC0_INTE0 + 1] == (0xCUL << 8 | 0xCUL << 16) );
+    assert( ioBank[ALIAS_SET + PROC0_INTE0 + 2] == 0 && ioBank[ALIAS_SET + PROC0_INTE0 + 3] == 0 );
+    Bus::Configure::DisableInterrupt( 0x10 );	//GPIO10
+    assert( ioBank[ALIAS_CLR + PROC0_INTE0 + 1] == 0xCUL << 8 );
+    assert( ioBank[ALIAS_CLR + PROC0_INTE0 + 0] == 0 );
+}
+
+int main()
+{
+    TestWrite();
+    TestRead();
+    TestConfigure();
+    printf( "rp2040_ram: ok\n" );
+    return 0;
+}
@@ -0,0 +1,146 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// STM32 port test against GPIO_TypeDef structs in RAM. GPIOx_BASE is not defined on purpose:
+// without TRIO_STM32_USE_BITBAND port must not need base addresses.
+// Checks BSRR writes and MODER/OSPEEDR/PUPDR masks of a PinList spread over two ports.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+typedef struct
+{
+    volatile uint32_t MODER, OTYPER, OSPEEDR, PUPDR, IDR, ODR, BSRR, LCKR, AFR[2];
+} GPIO_TypeDef;
+
+GPIO_TypeDef gpioa, gpiob;
+#define GPIOA (&gpioa)
+#define GPIOB (&gpiob)
+
+#include "trio.hpp"
+
+using namespace TRIO;
+
+//List bit:   0    1     2    3    4
+typedef PinList<Pa1, Pb15, Pa2, Pb0, Pa3Inv> Bus;
+
+static void ResetPorts()
+{
+    memset( (void *)&gpioa, 0, sizeof(gpioa) );
+    memset( (void *)&gpiob, 0, sizeof(gpiob) );
+}
+
+//Output register after BSRR write
+static uint32_t ApplyBsrr(uint32_t odr, uint32_t bsrr)
+{
+    return ( (odr & ~(bsrr >> 16)) | bsrr ) & 0xFFFF;
+}
+
+static void TestWrite()
+{
+    ResetPorts();
+    gpioa.ODR = 0xFFFF;
+    gpiob.ODR = 0x0000;
+    Bus::Write( 0x16 );	//Pb15, Pa2, Pa3Inv(low)
+    assert( ApplyBsrr( gpioa.ODR, gpioa.BSRR ) == 0xFFF5 );	//Pa1 and Pa3 cleared, Pa2 set
+    assert( ApplyBsrr( gpiob.ODR, gpiob.BSRR ) == 0x8000 );
+    assert( ((gpioa.BSRR | (gpioa.BSRR >> 16)) & 0xFFFF & ~0x000EUL) == 0 );	//only list pins are touched
+    assert( ((gpiob.BSRR | (gpiob.BSRR >> 16)) & 0xFFFF & ~0x8001UL) == 0 );
+
+    ResetPorts();
+    Bus::Set( 0x19 );	//Pa1, Pb0, Pa3Inv
+    assert( gpioa.BSRR == (0x2UL | (0x8UL << 16)) );
+    assert( gpiob.BSRR == 0x1UL );
+
+    ResetPorts();
+    Bus::Clear( 0x06 );	//Pb15, Pa2
+    assert( gpioa.BSRR == (0x4UL << 16) );
+    assert( gpiob.BSRR == (0x8000UL << 16) );
+
+    ResetPorts();
+    gpioa.ODR = 0x2;	//Pa1 high
+    Porta::Toggle<0x6>();
+    assert( gpioa.BSRR == ((0x2UL << 16) | 0x4UL) );
+}
+
+static void TestRead()
+{
+    ResetPorts();
+    gpioa.IDR = 0x0006;	//Pa1, Pa2 high, Pa3 low
+    gpiob.IDR = 0x0001;	//Pb0 high
+    assert( Bus::Read() == 0x1D );
+}
+
+static void TestConfigure()
+{
+    ResetPorts();
+    gpioa.PUPDR = gpiob.PUPDR = 0xFFFFFFFF;
+    Bus::Configure::OutPushPull_Fast<0x1F>();
+    assert( gpioa.MODER == 0x00000054 );	//01 for pins 1..3
+    assert( gpiob.MODER == 0x40000001 );	//01 for pins 0 and 15
+    assert( gpioa.OSPEEDR == 0x000000FC );
+    assert( gpiob.OSPEEDR == 0xC0000003 );
+    assert( gpioa.PUPDR == 0xFFFFFF03 );
+    assert( gpiob.PUPDR == 0x3FFFFFFC );
+    assert( gpioa.OTYPER == 0 && gpiob.OTYPER == 0 );
+
+    //Pb15 and Pb0 to input with pull-up, port A is not touched
+    Bus::Configure::InPullUp<0x0A>();
+    assert( gpiob.MODER == 0x00000000 );
+    assert( gpiob.PUPDR == 0x7FFFFFFD );
+    assert( gpioa.MODER == 0x00000054 );
+
+    //Runtime mask: Pa1 and Pa2 to open drain, slow
+    Bus::Configure::OutOpenDrain_Slow( 0x05 );
+    assert( gpioa.OTYPER == 0x6 );
+    assert( gpioa.OSPEEDR == 0x000000C0 );
+    assert( gpioa.MODER == 0x00000054 );
+
+    //Runtime mask: Pa3 to analog
+    Bus::Configure::InAnalog( 0x10 );
+    assert( gpioa.MODER == 0x000000D4 );
+    assert( gpioa.PUPDR == 0xFFFFFF03 );
+
+    //AF off returns pins to input, not to driving output
+    Bus::Configure::EnableAF<0x05>();	//Pa1, Pa2
+    assert( gpioa.MODER == 0x000000E8 );
+    Bus::Configure::DisableAF<0x01>();
+    assert( gpioa.MODER == 0x000000E0 );
+    Bus::Configure::DisableAF( 0x04 );
+    assert( gpioa.MODER == 0x000000C0 );
+}
+
+int main()
+{
+    TestWrite();
+    TestRead();
+    TestConfigure();
+    printf( "stm32_ram: ok\n" );
+    return 0;
+}
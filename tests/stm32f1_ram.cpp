@@ -0,0 +1,146 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// STM32F1 port test against GPIO_TypeDef and RCC_TypeDef structs in RAM.
+// Checks that Configure writes only the CRL/CRH half with pins in the mask, that pull direction of
+// pull-up/pull-down inputs is written through BSRR(ODR bit), BSRR writes and PortClocks bits in RCC->APB2ENR.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+typedef struct
+{
+    volatile uint32_t CRL, CRH, IDR, ODR, BSRR, BRR, LCKR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t CR, CFGR, CIR, APB2RSTR, APB1RSTR, AHBENR, APB2ENR, APB1ENR, BDCR, CSR;
+} RCC_TypeDef;
+
+GPIO_TypeDef gpioa, gpiob;
+RCC_TypeDef rcc;
+#define GPIOA (&gpioa)
+#define GPIOB (&gpiob)
+#define RCC (&rcc)
+
+#include "trio.hpp"
+
+using namespace TRIO;
+
+//List bit:   0    1    2    3
+typedef PinList<Pa1, Pa9, Pb3, Pb4Inv> Bus;
+
+static const uint32_t CrReset = 0x44444444;	//all pins floating inputs
+
+static void ResetPorts()
+{
+    memset( (void *)&gpioa, 0, sizeof(gpioa) );
+    memset( (void *)&gpiob, 0, sizeof(gpiob) );
+    gpioa.CRL = gpioa.CRH = gpiob.CRL = gpiob.CRH = CrReset;
+}
+
+static void TestConfigure()
+{
+    ResetPorts();
+    Bus::Configure::OutPushPull_Fast<0x1>();	//Pa1, CRL only
+    assert( gpioa.CRL == 0x44444434 );
+    assert( gpioa.CRH == CrReset );
+
+    Bus::Configure::OutOpenDrain_Slow<0x2>();	//Pa9, CRH only
+    assert( gpioa.CRH == 0x44444464 );
+    assert( gpioa.CRL == 0x44444434 );
+
+    //Runtime mask over both halves
+    Bus::Configure::OutPushPull_Medium( 0x3 );
+    assert( gpioa.CRL == 0x44444414 && gpioa.CRH == 0x44444414 );
+
+    //Alternate function keeps output speed, disabling it makes floating input
+    Bus::Configure::EnableAF<0x3>();
+    assert( gpioa.CRL == 0x44444494 && gpioa.CRH == 0x44444494 );
+    Bus::Configure::DisableAF<0x1>();
+    assert( gpioa.CRL == CrReset && gpioa.CRH == 0x44444494 );
+    Bus::Configure::DisableAF( 0x2 );
+    assert( gpioa.CRH == CrReset );
+
+    //Pull direction goes to ODR through BSRR, port A is not touched
+    ResetPorts();
+    Bus::Configure::InPullUp<0x4>();	//Pb3
+    assert( gpiob.BSRR == (1UL << 3) );
+    assert( gpiob.CRL == 0x44448444 && gpiob.CRH == CrReset );
+    Bus::Configure::InPullDown<0x8>();	//Pb4Inv, pull is not inverted
+    assert( gpiob.BSRR == (1UL << (16 + 4)) );
+    assert( gpiob.CRL == 0x44488444 );
+    assert( gpioa.CRL == CrReset && gpioa.BSRR == 0 );
+
+    Bus::Configure::InPullUp( 0x3 );	//Pa1 and Pa9
+    assert( gpioa.BSRR == 0x202UL );
+    assert( gpioa.CRL == 0x44444484 && gpioa.CRH == 0x44444484 );
+
+    Bus::Configure::InAnalog( 0x4 );
+    assert( gpiob.CRL == 0x44480444 );
+}
+
+static void TestWrite()
+{
+    ResetPorts();
+    Bus::Write( 0x5 );	//Pa1 and Pb3 high, Pa9 low, Pb4Inv inactive: line high
+    assert( gpioa.BSRR == ((0x202UL << 16) | 0x2UL) );	//one ClearAndSet, set wins for Pa1
+    assert( gpiob.BSRR == ((0x18UL << 16) | 0x18UL) );
+
+    Bus::Clear( 0x8 );	//Pb4Inv inactive
+    assert( gpiob.BSRR == 0x10UL );
+
+    gpioa.ODR = 0x2;	//Pa1 high
+    Porta::Toggle<0x202>();
+    assert( gpioa.BSRR == ((1UL << 17) | (1UL << 9)) );
+
+    gpiob.IDR = 0x0008;	//Pb3 high, Pb4 low
+    assert( Bus::Read() == 0xC );
+}
+
+static void TestClocks()
+{
+    rcc.APB2ENR = 0x1;	//AFIO clock is not touched
+    PortClocks<Bus>::Enable();
+    assert( rcc.APB2ENR == (0x1UL | (1UL << 2) | (1UL << 3)) );
+    PortClocks<Pb3>::Disable();
+    assert( rcc.APB2ENR == (0x1UL | (1UL << 2)) );
+    Pa9::HWSpecificAPI::Disable();
+    assert( rcc.APB2ENR == 0x1UL );
+}
+
+int main()
+{
+    TestConfigure();
+    TestWrite();
+    TestClocks();
+    printf( "stm32f1_ram: ok\n" );
+    return 0;
+}
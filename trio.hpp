@@ -38,6 +38,12 @@ namespace TRIO{
 #include <stdint.h>
 #include "trio_regwrapper.hpp"
 
+//Interrupt safe read-modify-write policies. See TRIO_RMW_POLICY
+#include "trio_atomic.hpp"
+
+//Opt-in cycle counter latency histograms of PinList/TPin operations and user code regions. See TRIO_LATENCY
+#include "trio_latency.hpp"
+
 // Implementation of a Pin that belongs to some port
 // Pin holds its position in the port and calls port API with mask to set, clear, read or toggle the pin.
 // Configuration and some HWSpecific API is also supported by TPin
@@ -55,9 +61,40 @@ namespace TRIO{
 //Support of multi pin ports
 #include "trio_pinlist.hpp"
 
+//SubList, Concat and Field PinList type operators
+#include "trio_pinlist_slicing.hpp"
+
+//Runtime pin descriptors and port grouped pin sets for pin assignments known only at runtime
+#include "trio_dynamic_pins.hpp"
+
 //Easy apply same configuration to comma delimited group of pins
 #include "trio_group_configure.hpp"
 
+//Apply several configurations of one port with one write per port register
+#include "trio_config_transaction.hpp"
+
+//Stage writes of several PinLists and pins and write each touched port once
+#include "trio_write_transaction.hpp"
+
+//Rising, falling and changed masks of PinList inputs with one Read() per poll
+#include "trio_edge_sampler.hpp"
+
+//Pin change handlers bound at compile time, dispatched over changed pins only
+#include "trio_pin_change.hpp"
+
+//Enable clocks of ports used by PinLists and pins with one write per clock enable register
+#include "trio_clock_gating.hpp"
+
+//STM32(not F1) only: alternate function routing of pin groups, file located in STM32 directory
+#if defined(TRIO_STM32_HAS_AFR)
+    #include "trio_stm32_af.hpp"
+#endif
+
+//Linux only: batched reading of edge events, file located in Linux directory
+#if defined(TRIO_LINUX_PORT_)
+    #include "trio_line_events.hpp"
+#endif
+
 //NullPort and NullPin can be useful as a dummy
 namespace TRIO
 {
@@ -66,6 +103,8 @@ namespace TRIO
         typedef uint8_t DataT;
         enum{ Id = '-' };
 		enum{ Width = sizeof(DataT) * 8 };
+        typedef Private::NullRegister ClockEnableReg;
+        static const uint32_t ClockEnableMask = 0;
 
         /*struct TRIOInternals
         {
@@ -91,6 +130,9 @@ namespace TRIO
         template<DataT value>
         static void Toggle(){ }
 
+        template<DataT MASK>
+        static DataT Read(){ return 0; }
+
         struct Configure
         {
             template<DataT MASK>
@@ -123,6 +165,47 @@ namespace TRIO
             static void EnableInterrupt(){ }
             template<DataT MASK>
             static void DisableInterrupt(){ }
+
+            static void OutPushPull_Slow(DataT mask){ }
+            static void OutPushPull_Medium(DataT mask){ }
+            static void OutPushPull_Fast(DataT mask){ }
+            static void OutOpenDrain_Slow(DataT mask){ }
+            static void OutOpenDrain_Medium(DataT mask){ }
+            static void OutOpenDrain_Fast(DataT mask){ }
+
+            static void InFloating(DataT mask){ }
+            static void InPullUp(DataT mask){ }
+            static void InPullDown(DataT mask){ }
+            static void InAnalog(DataT mask){ }
+
+            static void EnableAF(DataT mask){ }
+            static void DisableAF(DataT mask){ }
+            static void EnableInterrupt(DataT mask){ }
+            static void DisableInterrupt(DataT mask){ }
+        };
+
+        class ConfigTransaction
+        {
+        public:
+            void OutPushPull_Slow(DataT mask){ }
+            void OutPushPull_Medium(DataT mask){ }
+            void OutPushPull_Fast(DataT mask){ }
+            void OutOpenDrain_Slow(DataT mask){ }
+            void OutOpenDrain_Medium(DataT mask){ }
+            void OutOpenDrain_Fast(DataT mask){ }
+
+            void InFloating(DataT mask){ }
+            void InPullUp(DataT mask){ }
+            void InPullDown(DataT mask){ }
+            void InAnalog(DataT mask){ }
+
+            void EnableAF(DataT mask){ }
+            void DisableAF(DataT mask){ }
+            void EnableInterrupt(DataT mask){ }
+            void DisableInterrupt(DataT mask){ }
+
+            void Commit(){ }
+            void Cancel(){ }
         };
         //=============Hardware specific API for maximum flexibility======================
         //TPin public interface will be extended by this hardware specific API
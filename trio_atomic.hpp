@@ -0,0 +1,322 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Atomicity policies for port read-modify-write operations.
+//
+// Port Set/Clear/ClearAndSet/Toggle on AVR and STM8 are implemented as read-modify-write of output register.
+// If ISR changes some other pin of the same port between read and write, ISR's change is lost.
+// Select policy by defining TRIO_RMW_POLICY before #include "trio.hpp":
+//
+// #define TRIO_RMW_POLICY TRIO_RMW_NONE       - plain RMW, no protection. Default. Same code as before.
+// #define TRIO_RMW_POLICY TRIO_RMW_IRQLOCK    - RMW is done with interrupts disabled.
+// #define TRIO_RMW_POLICY TRIO_RMW_HWSETCLR   - use atomic hardware bit set/clear when it is available,
+//                                               fallback to TRIO_RMW_IRQLOCK otherwise.
+//                                               STM8: single bit compile time Set<>/Clear<>/Toggle<> are compiled to
+//                                               BSET/BRES/BCPL and are not locked.
+//                                               AVR: SBI/CBI are not guaranteed (memory mapped ports, -O0), so everything is locked.
+//                                               Ports with set/clear registers (XMega, STM32) are atomic anyway.
+// #define TRIO_RMW_POLICY TRIO_RMW_LOCKFREE   - no interrupts disabling at all, RMW is retried if somebody else wrote register.
+//                                               Cortex-M3 and higher: LDREX/STREX loop. Exception entry/exit clears
+//                                               exclusive monitor, so STREX fails and loop is retried if ISR came in between.
+//                                               Host port: std::atomic compare_exchange loop, so it is thread safe.
+//                                               Not available on AVR, STM8 and Cortex-M0(no exclusive access instructions).
+//
+// Interrupt latency bound.
+// All masks and values are calculated BEFORE interrupts are disabled (PinList mapping, inversion, ~masks).
+// Critical section contains only one register load, and/or/xor with precalculated values and one store:
+// AVR: in/lds, and, or, out/sts  - up to 6 cycles of disabled interrupts (plus 1 cycle of cli)
+// STM8: ld, and, or, ld          - up to 6 cycles of disabled interrupts (plus 1 cycle of sim)
+// There are no loops or calls inside critical section and its length doesn't depend on PinList size:
+// PinList spanning several ports makes separate short critical section for each port.
+//
+// TRIO_RMW_LOCKFREE adds no interrupt latency at all. Price is retry: RMW is repeated while interrupts or other
+// threads are writing same register between load and store. Retry loop body is the same load, and/or, store.
+
+#ifndef TRIO_ATOMIC_HPP_
+#define TRIO_ATOMIC_HPP_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+#include <stdint.h>
+
+#define TRIO_RMW_NONE       0
+#define TRIO_RMW_IRQLOCK    1
+#define TRIO_RMW_HWSETCLR   2
+#define TRIO_RMW_LOCKFREE   3
+
+#ifndef TRIO_RMW_POLICY
+    #define TRIO_RMW_POLICY TRIO_RMW_NONE
+#endif
+
+#if defined(__ICCSTM8__)
+    #include <intrinsics.h>
+#endif
+
+#if TRIO_RMW_POLICY == TRIO_RMW_LOCKFREE
+    #if defined(__CORTEX_M) && (__CORTEX_M >= 3)
+        #define TRIO_RMW_LOCKFREE_LDREX_
+    #elif !defined(__CORTEX_M) && !defined(__AVR__) && !defined(__ICCSTM8__) && (__cplusplus >= 201103L) //host build
+        #include <atomic>
+        #define TRIO_RMW_LOCKFREE_STDATOMIC_
+    #else
+        #error "TRIO_RMW_LOCKFREE needs LDREX/STREX(Cortex-M3 and higher) or host port. Use TRIO_RMW_IRQLOCK instead"
+    #endif
+#endif
+
+namespace TRIO
+{
+    namespace Private
+    {
+        /*Disables interrupts in constructor and restores previous interrupts state in destructor.
+        * Previous state is restored(not just enabled) so it is safe to use IrqLock inside ISR or another IrqLock*/
+        class IrqLock
+        {
+        #if defined(__AVR__)
+            uint8_t sreg;
+        public:
+            IrqLock(): sreg(SREG){ __asm__ __volatile__("cli" ::: "memory"); }
+            ~IrqLock(){ __asm__ __volatile__("" ::: "memory"); SREG = sreg; }
+        #elif defined(__ICCSTM8__)
+            __istate_t state;
+        public:
+            IrqLock(): state(__get_interrupt_state()){ __disable_interrupt(); }
+            ~IrqLock(){ __set_interrupt_state(state); }
+        #elif defined(__CORTEX_M)  //CMSIS core header should be included before trio.hpp
+            uint32_t primask;
+        public:
+            IrqLock(): primask(__get_PRIMASK()){ __disable_irq(); }
+            ~IrqLock(){ __set_PRIMASK(primask); }
+        #else                       //Unknown platform or host build. Nothing to lock.
+        public:
+            IrqLock(){ }
+        #endif
+        private:
+            IrqLock(const IrqLock &);
+            IrqLock &operator=(const IrqLock &);
+        };
+
+        /*Plain read-modify-write. REG - class made by IO_REG_WRAPPER macro.
+        * Compile time versions are used by ports for compile time masks*/
+        struct RmwPolicyNone
+        {
+            template< class REG >
+            static void Or(typename REG::RegDataT value){ REG::Or(value); }
+            template< class REG >
+            static void And(typename REG::RegDataT value){ REG::And(value); }
+            template< class REG >
+            static void Xor(typename REG::RegDataT value){ REG::Xor(value); }
+            template< class REG >
+            static void AndOr(typename REG::RegDataT andMask, typename REG::RegDataT orMask){ REG::AndOr(andMask, orMask); }
+
+            template< class REG, typename REG::RegDataT VALUE >
+            static void Or(){ REG::Or(VALUE); }
+            template< class REG, typename REG::RegDataT VALUE >
+            static void And(){ REG::And(VALUE); }
+            template< class REG, typename REG::RegDataT VALUE >
+            static void Xor(){ REG::Xor(VALUE); }
+            template< class REG, typename REG::RegDataT ANDMASK, typename REG::RegDataT ORMASK >
+            static void AndOr(){ REG::AndOr(ANDMASK, ORMASK); }
+        };
+
+        /*Read-modify-write with interrupts disabled.
+        * Values are passed already calculated, so only register access is inside the lock*/
+        struct RmwPolicyIrqLock
+        {
+            template< class REG >
+            static void Or(typename REG::RegDataT value){ IrqLock lock; REG::Or(value); }
+            template< class REG >
+            static void And(typename REG::RegDataT value){ IrqLock lock; REG::And(value); }
+            template< class REG >
+            static void Xor(typename REG::RegDataT value){ IrqLock lock; REG::Xor(value); }
+            template< class REG >
+            static void AndOr(typename REG::RegDataT andMask, typename REG::RegDataT orMask){ IrqLock lock; REG::AndOr(andMask, orMask); }
+
+            template< class REG, typename REG::RegDataT VALUE >
+            static void Or(){ IrqLock lock; REG::Or(VALUE); }
+            template< class REG, typename REG::RegDataT VALUE >
+            static void And(){ IrqLock lock; REG::And(VALUE); }
+            template< class REG, typename REG::RegDataT VALUE >
+            static void Xor(){ IrqLock lock; REG::Xor(VALUE); }
+            template< class REG, typename REG::RegDataT ANDMASK, typename REG::RegDataT ORMASK >
+            static void AndOr(){ IrqLock lock; REG::AndOr(ANDMASK, ORMASK); }
+        };
+
+        //Compile time check for exactly one bit set in VALUE
+        template< uint32_t VALUE >
+        struct IsSingleBit{ static const bool value = (VALUE != 0) && ((VALUE & (VALUE - 1)) == 0); };
+
+        /*Single bit compile time operations are left unlocked where compiler is known to emit
+        * atomic bit instructions for them. Everything else is locked*/
+        struct RmwPolicyHwSetClr: public RmwPolicyIrqLock
+        {
+        #if defined(__ICCSTM8__)
+            static const bool SingleBitIsAtomic = true;     //BSET/BRES/BCPL
+        #else
+            static const bool SingleBitIsAtomic = false;
+        #endif
+            using RmwPolicyIrqLock::Or;
+            using RmwPolicyIrqLock::And;
+            using RmwPolicyIrqLock::Xor;
+
+            template< class REG, typename REG::RegDataT VALUE >
+            static void Or()
+            {
+                if( SingleBitIsAtomic && IsSingleBit<VALUE>::value )
+                    REG::Or(VALUE);
+                else
+                    RmwPolicyIrqLock::Or<REG, VALUE>();
+            }
+            template< class REG, typename REG::RegDataT VALUE >
+            static void And()
+            {
+                if( SingleBitIsAtomic && IsSingleBit<(typename REG::RegDataT)~VALUE>::value )
+                    REG::And(VALUE);
+                else
+                    RmwPolicyIrqLock::And<REG, VALUE>();
+            }
+            template< class REG, typename REG::RegDataT VALUE >
+            static void Xor()
+            {
+                if( SingleBitIsAtomic && IsSingleBit<VALUE>::value )
+                    REG::Xor(VALUE);
+                else
+                    RmwPolicyIrqLock::Xor<REG, VALUE>();
+            }
+        };
+
+    #if defined(TRIO_RMW_LOCKFREE_LDREX_)
+        //Exclusive load/store of register by its size. CMSIS intrinsics are used
+        template< int SIZE >
+        struct ExclusiveAccess;
+
+        template<>
+        struct ExclusiveAccess<1>
+        {
+            static uint8_t Load(volatile void *addr){ return __LDREXB( (volatile uint8_t *)addr ); }
+            static bool Store(uint8_t value, volatile void *addr){ return __STREXB( value, (volatile uint8_t *)addr ) == 0; }
+        };
+        template<>
+        struct ExclusiveAccess<2>
+        {
+            static uint16_t Load(volatile void *addr){ return __LDREXH( (volatile uint16_t *)addr ); }
+            static bool Store(uint16_t value, volatile void *addr){ return __STREXH( value, (volatile uint16_t *)addr ) == 0; }
+        };
+        template<>
+        struct ExclusiveAccess<4>
+        {
+            static uint32_t Load(volatile void *addr){ return __LDREXW( (volatile uint32_t *)addr ); }
+            static bool Store(uint32_t value, volatile void *addr){ return __STREXW( value, (volatile uint32_t *)addr ) == 0; }
+        };
+
+        /*LDREX/STREX retry loop. STREX fails if exception was taken after LDREX,
+        * so ISR writes to the same register are never lost*/
+        struct RmwPolicyLockFree
+        {
+            template< class REG >
+            static void AndOr(typename REG::RegDataT andMask, typename REG::RegDataT orMask)
+            {
+                typedef typename REG::RegDataT RegDataT;
+                typedef ExclusiveAccess<sizeof(RegDataT)> Exclusive;
+                volatile RegDataT &reg = REG::GetReference();
+                RegDataT value;
+                do{
+                    value = (RegDataT)((Exclusive::Load( &reg ) & andMask) | orMask);
+                }while( !Exclusive::Store( value, &reg ) );
+            }
+            template< class REG >
+            static void Or(typename REG::RegDataT value){ AndOr<REG>( (typename REG::RegDataT)~0, value ); }
+            template< class REG >
+            static void And(typename REG::RegDataT value){ AndOr<REG>( value, 0 ); }
+            template< class REG >
+            static void Xor(typename REG::RegDataT value)
+            {
+                typedef typename REG::RegDataT RegDataT;
+                typedef ExclusiveAccess<sizeof(RegDataT)> Exclusive;
+                volatile RegDataT &reg = REG::GetReference();
+                RegDataT newValue;
+                do{
+                    newValue = (RegDataT)(Exclusive::Load( &reg ) ^ value);
+                }while( !Exclusive::Store( newValue, &reg ) );
+            }
+
+            template< class REG, typename REG::RegDataT VALUE >
+            static void Or(){ Or<REG>(VALUE); }
+            template< class REG, typename REG::RegDataT VALUE >
+            static void And(){ And<REG>(VALUE); }
+            template< class REG, typename REG::RegDataT VALUE >
+            static void Xor(){ Xor<REG>(VALUE); }
+            template< class REG, typename REG::RegDataT ANDMASK, typename REG::RegDataT ORMASK >
+            static void AndOr(){ AndOr<REG>(ANDMASK, ORMASK); }
+        };
+    #elif defined(TRIO_RMW_LOCKFREE_STDATOMIC_)
+        /*std::atomic version for host port. REG should provide GetAtomic(), see Host/trio_gpio_implementation.hpp*/
+        struct RmwPolicyLockFree
+        {
+            template< class REG >
+            static void AndOr(typename REG::RegDataT andMask, typename REG::RegDataT orMask)
+            {
+                typedef typename REG::RegDataT RegDataT;
+                std::atomic<RegDataT> &reg = REG::GetAtomic();
+                RegDataT oldValue = reg.load( std::memory_order_relaxed );
+                while( !reg.compare_exchange_weak( oldValue, (RegDataT)((oldValue & andMask) | orMask) ) )
+                    ;
+            }
+            template< class REG >
+            static void Or(typename REG::RegDataT value){ REG::GetAtomic().fetch_or( value ); }
+            template< class REG >
+            static void And(typename REG::RegDataT value){ REG::GetAtomic().fetch_and( value ); }
+            template< class REG >
+            static void Xor(typename REG::RegDataT value){ REG::GetAtomic().fetch_xor( value ); }
+
+            template< class REG, typename REG::RegDataT VALUE >
+            static void Or(){ Or<REG>(VALUE); }
+            template< class REG, typename REG::RegDataT VALUE >
+            static void And(){ And<REG>(VALUE); }
+            template< class REG, typename REG::RegDataT VALUE >
+            static void Xor(){ Xor<REG>(VALUE); }
+            template< class REG, typename REG::RegDataT ANDMASK, typename REG::RegDataT ORMASK >
+            static void AndOr(){ AndOr<REG>(ANDMASK, ORMASK); }
+        };
+    #endif
+
+        #if TRIO_RMW_POLICY == TRIO_RMW_NONE
+            typedef RmwPolicyNone RmwPolicy;
+        #elif TRIO_RMW_POLICY == TRIO_RMW_IRQLOCK
+            typedef RmwPolicyIrqLock RmwPolicy;
+        #elif TRIO_RMW_POLICY == TRIO_RMW_HWSETCLR
+            typedef RmwPolicyHwSetClr RmwPolicy;
+        #elif TRIO_RMW_POLICY == TRIO_RMW_LOCKFREE
+            typedef RmwPolicyLockFree RmwPolicy;
+        #else
+            #error "Unknown TRIO_RMW_POLICY"
+        #endif
+    }//namespace Private
+}//namespace TRIO
+
+#endif//TRIO_ATOMIC_HPP_
@@ -0,0 +1,155 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Enable or disable GPIO clocks of all ports used by group of PinLists and pins.
+// Ports in use are collected at compile time, duplicates removed and enable bits are grouped
+// by clock enable register. Each register is written once(one read-modify-write protected according to TRIO_RMW_POLICY).
+// So init of 5 ports on STM32F4 is one RCC->AHB1ENR |= 0x1F instead of five RMW of the same register.
+// Disable() lets gate clocks of GPIO banks when they are not used to save power.
+//
+// Port should provide ClockEnableReg(class made by IO_REG_WRAPPER) and ClockEnableMask.
+// Ports without GPIO clock gating use Private::NullRegister and 0 mask, nothing is written for them.
+//
+// Usage example:
+// typedef PinList<Pa0, Pb3, Pc7> Bus;
+// PortClocks< Bus, Pd2, Pa5 >::Enable();    //one write to RCC->AHB1ENR for ports A, B, C, D
+
+#ifndef TRIO_CLOCK_GATING_HPP_
+#define TRIO_CLOCK_GATING_HPP_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+#include <stdint.h>
+#include "loki/Typelist.h"
+#include "loki/TypeManip.h"
+#include "trio_pinlist.hpp"
+
+namespace TRIO
+{
+    namespace Private
+    {
+        //True if T has Ports list(PinList does)
+        template< class T >
+        class HasPortsList
+        {
+            typedef char Yes;
+            typedef long No;
+            template< class U > static Yes Test(typename U::Ports *);
+            template< class U > static No Test(...);
+        public:
+            static const bool value = sizeof(Test<T>(0)) == sizeof(Yes);
+        };
+
+        //Ports used by PinList or by single pin
+        template< class T, bool IS_PINLIST = HasPortsList<T>::value >
+        struct PortsOf
+        {
+            typedef typename T::Ports Result;
+        };
+        template< class T >
+        struct PortsOf< T, false >
+        {
+            typedef Loki::Typelist< typename T::TRIOInternals::Port, Loki::NullType > Result;
+        };
+
+        //Ports of all list elements, duplicates are not removed here
+        template< class LIST >
+        struct PortsOfAll;
+        template<>
+        struct PortsOfAll< Loki::NullType >
+        {
+            typedef Loki::NullType Result;
+        };
+        template< class Head, class Tail >
+        struct PortsOfAll< Loki::Typelist<Head, Tail> >
+        {
+            typedef typename Loki::TL::Append< typename PortsOf<Head>::Result, typename PortsOfAll<Tail>::Result >::Result Result;
+        };
+
+        //Get clock enable register of the port
+        template< class PORT, class U, uint32_t N >
+        struct mfGetClockEnableReg
+        {
+            typedef typename PORT::ClockEnableReg Result;
+        };
+
+        //Clock enable bits of the port if they are in REG
+        template< class PORT, class REG, uint32_t N >
+        struct mfClockEnableMaskOfReg
+        {
+            typedef uint32_t RetvalType;
+            static const uint32_t value = Loki::IsSameType<typename PORT::ClockEnableReg, REG>::value ? PORT::ClockEnableMask : 0;
+        };
+
+        /*T clock enable register
+        * U list of ports
+        * N 1 - enable, 0 - disable
+        * Write all bits of ports that belong to T register at once*/
+        template< class T, class U, uint32_t N, uint32_t M >
+        class rfWriteClockEnableReg
+        {
+            static const uint32_t MASK = Utils::metaForEach_bitOr< U, mfClockEnableMaskOfReg, T >::value;
+        public:
+            static void Run()
+            {
+                if( N )
+                    RmwPolicy::Or< T, MASK >();
+                else
+                    RmwPolicy::And< T, ~MASK >();
+            }
+        };
+
+        template< class LIST >
+        class PortClocksImplementation
+        {
+            typedef typename Loki::TL::NoDuplicates< typename PortsOfAll<LIST>::Result >::Result        Ports;
+            typedef typename Loki::TL::NoDuplicates< typename Utils::metaForEach_TList<Ports, mfGetClockEnableReg>::Result >::Result    AllRegs;
+            //Nothing to write for ports without clock gating
+            typedef typename Loki::TL::EraseAll< AllRegs, NullRegister >::Result    Regs;
+        public:
+            static void Enable(){ Utils::runForEach< Regs, rfWriteClockEnableReg, Ports, 1 >::Run(); }
+            static void Disable(){ Utils::runForEach< Regs, rfWriteClockEnableReg, Ports, 0 >::Run(); }
+        };
+    }//namespace Private
+
+    //T1...T16 - PinLists or pins
+    template<
+        typename T1  = Loki::NullType, typename T2  = Loki::NullType, typename T3  = Loki::NullType,
+        typename T4  = Loki::NullType, typename T5  = Loki::NullType, typename T6  = Loki::NullType,
+        typename T7  = Loki::NullType, typename T8  = Loki::NullType, typename T9  = Loki::NullType,
+        typename T10 = Loki::NullType, typename T11 = Loki::NullType, typename T12 = Loki::NullType,
+        typename T13 = Loki::NullType, typename T14 = Loki::NullType, typename T15 = Loki::NullType,
+        typename T16 = Loki::NullType
+    >
+    class PortClocks: public Private::PortClocksImplementation< typename Loki::TL::MakeTypelist<T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16>::Result >
+    {
+    };
+}//namespace TRIO
+
+#endif//TRIO_CLOCK_GATING_HPP_
@@ -0,0 +1,62 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Collect several configuration changes of one port and apply them at once.
+// Each Configure::XXX<MASK>() of a port does its own read-modify-write of every register involved
+// (three of them on STM8: DDR, CR1, CR2). Consecutive configure calls on the same port repeat them.
+// ConfigTransaction stores changes in RAM and Commit() does only one read and one write per register.
+//
+// Masks are runtime values, so it is fine for reconfiguration on the fly (bus turnaround etc.),
+// not only for init. Transaction object is cheap: two DataT per port register on stack.
+// For same bits the last call wins, like it would be with sequential Configure calls.
+// Nothing is written to hardware until Commit(). Cancel() drops staged changes.
+// Registers are written in the same order Configure does it, so no glitch modes are introduced.
+//
+// Port should provide nested ConfigTransaction class (see STM8 and AVR ports implementation)
+//
+// Usage example:
+// TRIO::ConfigTransaction<Portb> tr;
+// tr.InPullUp(0x0F);
+// tr.OutPushPull_Fast(0xF0);
+// tr.Commit();
+
+#ifndef TRIO_CONFIG_TRANSACTION_HPP_
+#define TRIO_CONFIG_TRANSACTION_HPP_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+namespace TRIO
+{
+    template< class PORT >
+    class ConfigTransaction: public PORT::ConfigTransaction
+    {
+    };
+}
+
+#endif//TRIO_CONFIG_TRANSACTION_HPP_
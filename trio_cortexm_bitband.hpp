@@ -0,0 +1,78 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#ifndef TRIO_CORTEXM_BITBAND_HPP_
+#define TRIO_CORTEXM_BITBAND_HPP_
+
+/*Cortex-M3/M4 bit-band alias addresses
+* Every bit of first 1MB of SRAM(0x20000000) and peripheral(0x40000000) regions has its own word in alias region.
+* Load from alias word returns the bit(0 or 1), store of 0 or 1 changes only this bit, without read-modify-write by CPU.
+* alias = region base + 0x02000000 + (address - region base) * 32 + bit * 4
+*
+* Everything is computed at compile time, so alias addresses are checked by any C++ compiler(see checks at the end of file).
+* Cortex-M0/M0+/M7/M33 don't have bit-band. Registers outside of bit-band regions are rejected at compile time
+* (for example STM32F3/L4 GPIO at 0x48000000).*/
+
+#include <stdint.h>
+#include "boost_static_assert.h"
+
+namespace TRIO
+{
+    namespace Private
+    {
+        //ADDR - address of 32 bit register or RAM word, BIT - bit number in it
+        template< uint32_t ADDR, uint8_t BIT >
+        struct BitBandAlias
+        {
+            BOOST_STATIC_ASSERT( BIT < 32 );
+            BOOST_STATIC_ASSERT( (ADDR >= 0x20000000UL && ADDR < 0x20100000UL) || (ADDR >= 0x40000000UL && ADDR < 0x40100000UL) );
+
+            static const uint32_t RegionBase = ADDR & 0xF0000000UL;
+            static const uint32_t value = RegionBase + 0x02000000UL + (ADDR - RegionBase) * 32 + BIT * 4;
+
+            static volatile uint32_t &Reference(){ return *reinterpret_cast<volatile uint32_t *>( value ); }
+        };
+
+        //Bit number of single bit MASK
+        template< uint32_t MASK >
+        struct BitNumberOfMask
+        {
+            BOOST_STATIC_ASSERT( MASK != 0 && (MASK & (MASK - 1)) == 0 );
+            static const uint8_t value = 1 + BitNumberOfMask< (MASK >> 1) >::value;
+        };
+        template<>
+        struct BitNumberOfMask<1>{ static const uint8_t value = 0; };
+
+        //Address math checks, values are from ARM and STM32 reference manuals
+        BOOST_STATIC_ASSERT( (BitBandAlias<0x20000000UL, 0>::value == 0x22000000UL) );
+        BOOST_STATIC_ASSERT( (BitBandAlias<0x20000300UL, 2>::value == 0x22006008UL) );
+        BOOST_STATIC_ASSERT( (BitBandAlias<0x40020010UL, 3>::value == 0x4240020CUL) );   //STM32F4 GPIOA IDR bit 3
+        BOOST_STATIC_ASSERT( (BitBandAlias<0x4001080CUL, 15>::value == 0x422101BCUL) );  //STM32F1 GPIOA ODR bit 15
+        BOOST_STATIC_ASSERT( BitNumberOfMask<0x8000>::value == 15 );
+    }//namespace Private
+}//namespace TRIO
+
+#endif //TRIO_CORTEXM_BITBAND_HPP_
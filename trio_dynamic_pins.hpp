@@ -0,0 +1,243 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Runtime pin descriptors for pin assignments unknown at compile time(loaded from EEPROM at boot etc).
+// DynamicPin is a port handle plus pin mask. Port handle is a constant table of port operations with
+// runtime mask, so backends' Set/Clear/Toggle/Read are used as is. Inverted pins get their own port handle.
+// DynamicPinSet keeps per-port aggregated masks sorted by port handle, Set/Clear/Toggle/Read of the set
+// are made with one port operation per port, not per pin.
+//
+// Usage example:
+// typedef DynamicPorts<Porta, Portb, Portc> BoardPorts;
+// DynamicPinSet<3> leds;
+// leds.Add( BoardPorts::Pin( eepromPortId, eepromPinNumber ) );   //port Id is 'A', 'B'...
+// leds.Add( DynamicPin::Of<Pb5>() );
+// leds.Set();       //one port Set per port in the set
+
+#ifndef TRIO_DYNAMIC_PINS_HPP_
+#define TRIO_DYNAMIC_PINS_HPP_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+#include <stdint.h>
+#include "loki/Typelist.h"
+#include "trio_pinlist.hpp"
+
+namespace TRIO
+{
+    //Port handle is a pointer to constant table of port operations
+    typedef const Private::PinIndexPortOps *DynamicPortHandle;
+
+    template< class PORT >
+    inline DynamicPortHandle GetPortHandle(){ return &Private::PinIndexPortOpsOf<PORT, false>::value; }
+
+    struct DynamicPin
+    {
+        DynamicPortHandle Port;
+        uint32_t Mask;
+
+        DynamicPin(): Port(0), Mask(0){ }
+        //Invalid pin if there is no port or pin number is out of port width
+        DynamicPin(DynamicPortHandle port, uint8_t pinNumber):
+            Port( (port && pinNumber < port->Width) ? port : 0 ),
+            Mask( Port ? (uint32_t)1U << pinNumber : 0 ){ }
+
+        //Descriptor of compile time pin
+        template< class PIN >
+        static DynamicPin Of()
+        {
+            DynamicPin pin;
+            pin.Port = &Private::PinIndexPortOpsOf< typename PIN::TRIOInternals::Port, PIN::TRIOInternals::Inverted >::value;
+            pin.Mask = (uint32_t)1U << PIN::TRIOInternals::PortPinNumber;
+            return pin;
+        }
+
+        bool IsValid() const { return Port != 0; }
+
+        void Set() const { Port->Set( Mask ); }
+        void Clear() const { Port->Clear( Mask ); }
+        void Toggle() const { Port->Toggle( Mask ); }
+        bool IsSet() const { return (Port->Read() & Mask) != 0; }
+    };
+
+    namespace Private
+    {
+        //Search port by Id in list of ports
+        template< class TList >
+        struct DynamicPortById
+        {
+            static DynamicPortHandle Get(char id)
+            {
+                return ( id == (char)TList::Head::Id ) ? GetPortHandle<typename TList::Head>() : DynamicPortById<typename TList::Tail>::Get( id );
+            }
+        };
+
+        template<>
+        struct DynamicPortById< Loki::NullType >
+        {
+            static DynamicPortHandle Get(char){ return 0; }
+        };
+    }
+
+    /*Ports which pins may be assigned at runtime. Port is selected by its Id('A', 'B'...)
+    * Search is not constant time, it is meant to be done once at boot*/
+    template<
+        typename T1  = Loki::NullType, typename T2  = Loki::NullType, typename T3  = Loki::NullType,
+        typename T4  = Loki::NullType, typename T5  = Loki::NullType, typename T6  = Loki::NullType,
+        typename T7  = Loki::NullType, typename T8  = Loki::NullType, typename T9  = Loki::NullType,
+        typename T10 = Loki::NullType, typename T11 = Loki::NullType, typename T12 = Loki::NullType,
+        typename T13 = Loki::NullType, typename T14 = Loki::NullType, typename T15 = Loki::NullType,
+        typename T16 = Loki::NullType >
+    struct DynamicPorts
+    {
+        typedef typename Loki::TL::MakeTypelist<T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16>::Result	Ports;
+
+        //Returns 0 if there is no such port
+        static DynamicPortHandle ById(char id){ return Private::DynamicPortById<Ports>::Get( id ); }
+
+        //Returns invalid pin if there is no such port or pin number is out of port width
+        static DynamicPin Pin(char portId, uint8_t pinNumber){ return DynamicPin( ById( portId ), pinNumber ); }
+    };
+
+    /*Set of runtime pins grouped by port
+    * MAX_PORTS Maximum number of different port handles in set*/
+    template< uint8_t MAX_PORTS >
+    class DynamicPinSet
+    {
+        struct PortMask
+        {
+            DynamicPortHandle Port;
+            uint32_t Mask;
+        };
+
+        PortMask _ports[MAX_PORTS];	//sorted by port handle
+        uint8_t _count;
+
+        //Position of port in sorted array or position where it should be inserted
+        uint8_t Find(DynamicPortHandle port) const
+        {
+            uint8_t i = 0;
+            while( i < _count && (uintptr_t)_ports[i].Port < (uintptr_t)port )
+                i++;
+            return i;
+        }
+
+    public:
+        DynamicPinSet(): _count(0){ }
+
+        //Returns false if pin is invalid or set is full
+        bool Add(const DynamicPin &pin)
+        {
+            if( !pin.IsValid() )
+                return false;
+
+            const uint8_t i = Find( pin.Port );
+            if( i < _count && _ports[i].Port == pin.Port )
+            {
+                _ports[i].Mask |= pin.Mask;
+                return true;
+            }
+            if( _count == MAX_PORTS )
+                return false;
+
+            for( uint8_t j = _count; j > i; j-- )
+                _ports[j] = _ports[j - 1];
+            _ports[i].Port = pin.Port;
+            _ports[i].Mask = pin.Mask;
+            _count++;
+            return true;
+        }
+
+        void Remove(const DynamicPin &pin)
+        {
+            const uint8_t i = Find( pin.Port );
+            if( i == _count || _ports[i].Port != pin.Port )
+                return;
+
+            _ports[i].Mask &= ~pin.Mask;
+            if( _ports[i].Mask )
+                return;
+
+            _count--;
+            for( uint8_t j = i; j < _count; j++ )
+                _ports[j] = _ports[j + 1];
+        }
+
+        void RemoveAll(){ _count = 0; }
+
+        bool Contains(const DynamicPin &pin) const
+        {
+            const uint8_t i = Find( pin.Port );
+            return i < _count && _ports[i].Port == pin.Port && (_ports[i].Mask & pin.Mask) == pin.Mask && pin.Mask;
+        }
+
+        bool IsEmpty() const { return _count == 0; }
+        uint8_t PortsCount() const { return _count; }
+
+        //One port operation per port
+        void Set() const {		for( uint8_t i = 0; i < _count; i++ ) _ports[i].Port->Set( _ports[i].Mask ); }
+        void Clear() const {	for( uint8_t i = 0; i < _count; i++ ) _ports[i].Port->Clear( _ports[i].Mask ); }
+        void Toggle() const {	for( uint8_t i = 0; i < _count; i++ ) _ports[i].Port->Toggle( _ports[i].Mask ); }
+
+        //Returns set of pins which are high. Each port is read once
+        DynamicPinSet Read() const
+        {
+            DynamicPinSet result;
+            for( uint8_t i = 0; i < _count; i++ )
+            {
+                const uint32_t value = _ports[i].Port->Read() & _ports[i].Mask;
+                if( value )
+                {
+                    result._ports[result._count].Port = _ports[i].Port;
+                    result._ports[result._count].Mask = value;
+                    result._count++;
+                }
+            }
+            return result;
+        }
+
+        bool IsAnySet() const
+        {
+            for( uint8_t i = 0; i < _count; i++ )
+                if( _ports[i].Port->Read() & _ports[i].Mask )
+                    return true;
+            return false;
+        }
+
+        bool AreAllSet() const
+        {
+            for( uint8_t i = 0; i < _count; i++ )
+                if( (_ports[i].Port->Read() & _ports[i].Mask) != _ports[i].Mask )
+                    return false;
+            return true;
+        }
+    };
+}//namespace TRIO
+
+#endif//TRIO_DYNAMIC_PINS_HPP_
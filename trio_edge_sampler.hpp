@@ -0,0 +1,85 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Bit-parallel edge detection of PinList(or port) inputs.
+// Sampler keeps previous sample, each Sample() is one Read() and XOR with previous value
+// no matter how many pins there are. Rising, falling and changed masks are in PinList bit order.
+//
+// Usage example:
+// typedef PinList<Pa0, Pa1, Pb4Inv, Pc7> Buttons;
+// EdgeSampler<Buttons> buttons;
+// buttons.Reset();					//after pins are configured
+// ...
+// if( buttons.Sample() )			//poll
+//     OnPressed( buttons.Rising() );
+
+#ifndef TRIO_EDGE_SAMPLER_HPP_
+#define TRIO_EDGE_SAMPLER_HPP_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+namespace TRIO
+{
+    template< class PL >
+    class EdgeSampler
+    {
+    public:
+        typedef typename PL::DataT DataT;
+
+        explicit EdgeSampler(DataT initial = 0): _value(initial), _changed(0){ }
+
+        //Take current input state as previous sample, no edges are reported for it
+        void Reset()
+        {
+            _value = PL::Read();
+            _changed = 0;
+        }
+
+        //Read inputs, returns mask of changed pins
+        DataT Sample()
+        {
+            const DataT value = PL::Read();
+            _changed = (DataT)(value ^ _value);
+            _value = value;
+            return _changed;
+        }
+
+        //Results of last Sample()
+        DataT Value() const { return _value; }
+        DataT Changed() const { return _changed; }
+        DataT Rising() const { return (DataT)(_changed & _value); }
+        DataT Falling() const { return (DataT)(_changed & ~_value); }
+
+    private:
+        DataT _value;	//last sample
+        DataT _changed;
+    };
+}//namespace TRIO
+
+#endif//TRIO_EDGE_SAMPLER_HPP_
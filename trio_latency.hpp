@@ -0,0 +1,260 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Opt-in latency histograms of PinList/TPin operations and user defined code regions.
+// Disabled by default: unless TRIO_LATENCY is defined to 1 all probes expand to nothing.
+// Each probe reads cycle counter on entry and exit and accumulates count, min, max and
+// log2 buckets(bucket N counts durations of [2^N, 2^(N+1)) ticks, bucket 0 also counts 0) in
+// a fixed size zero initialized histogram. Histograms link themselves into a list on first record,
+// so no constructors run at startup and RAM footprint is known at link time.
+//
+// Cycle counter:
+//   Cortex-M3/M4/M7/M33 - DWT_CYCCNT, call LatencyInit() once to start it
+//   x86 host            - rdtsc
+//   other unix hosts    - clock_gettime(CLOCK_MONOTONIC), nanoseconds
+//   AVR, STM8 and other - no free running cycle counter, define TRIO_LATENCY_COUNTER() to read a timer
+//                         and TRIO_LATENCY_COUNTER_MASK to its width, e.g. for 16 bit timer 1 on AVR:
+//                         #define TRIO_LATENCY_COUNTER() TCNT1
+//                         #define TRIO_LATENCY_COUNTER_MASK 0xFFFFUL
+// Library probes are named by signature of instrumented function(TRIO_LATENCY_FUNCTION), so every PinList and
+// pin has its own distinguishable histogram. Names are kept in memory, define TRIO_LATENCY_FUNCTION(NAME) NAME
+// for short generic names like "PinList::Write" when memory is tight(AVR keeps string literals in RAM).
+// Durations include counter read overhead, measure an empty region to get it.
+// Histograms are not interrupt safe: the same probe hit from ISR and main may lose a sample.
+//
+// Usage example:
+// #define TRIO_LATENCY 1
+// #include "trio.hpp"
+// LatencyInit();
+// ...
+// void Poll()
+// {
+//     TRIO_LATENCY_REGION("Poll");	//time from here to the end of scope
+//     ...
+// }
+// ...
+// LatencyDump( Print );	//void Print(const LatencyHistogram &h), called for each recorded histogram
+
+#ifndef TRIO_LATENCY_HPP_
+#define TRIO_LATENCY_HPP_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+#ifndef TRIO_LATENCY
+    #define TRIO_LATENCY 0
+#endif
+
+#ifndef TRIO_LATENCY_BUCKETS
+    #define TRIO_LATENCY_BUCKETS 32
+#endif
+
+namespace TRIO
+{
+    struct LatencyHistogram
+    {
+        const char *Name;			//Region or operation name, null until first record
+        LatencyHistogram *Next;		//Next recorded histogram
+        uint32_t Count;
+        uint32_t Min;
+        uint32_t Max;
+        uint32_t Buckets[TRIO_LATENCY_BUCKETS];
+    };
+}
+
+#if TRIO_LATENCY
+
+//Name of library probe: signature of instrumented function, which includes PinList pins or pin's port and number
+#if !defined(TRIO_LATENCY_FUNCTION)
+    #if defined(__GNUC__) || defined(__IAR_SYSTEMS_ICC__)
+        #define TRIO_LATENCY_FUNCTION(NAME) __PRETTY_FUNCTION__
+    #elif defined(_MSC_VER)
+        #define TRIO_LATENCY_FUNCTION(NAME) __FUNCSIG__
+    #else
+        #define TRIO_LATENCY_FUNCTION(NAME) NAME
+    #endif
+#endif
+
+#if !defined(TRIO_LATENCY_COUNTER)
+    #if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+        #define TRIO_LATENCY_DWT
+        #define TRIO_LATENCY_COUNTER() (*(volatile uint32_t*)0xE0001004UL)	//DWT_CYCCNT
+    #elif defined(__x86_64__) || defined(__i386__)
+        #include <x86intrin.h>
+        #define TRIO_LATENCY_COUNTER() ((uint32_t)__rdtsc())
+    #elif defined(__unix__)
+        #include <time.h>
+        #define TRIO_LATENCY_MONOTONIC_CLOCK
+        #define TRIO_LATENCY_COUNTER() (TRIO::Private::LatencyMonotonicNs())
+    #else
+        #error "No cycle counter for this platform. Define TRIO_LATENCY_COUNTER() to read a free running timer"
+    #endif
+#endif
+
+#ifndef TRIO_LATENCY_COUNTER_MASK
+    #define TRIO_LATENCY_COUNTER_MASK 0xFFFFFFFFUL
+#endif
+
+namespace TRIO
+{
+    namespace Private
+    {
+    #if defined(TRIO_LATENCY_MONOTONIC_CLOCK)
+        inline uint32_t LatencyMonotonicNs()
+        {
+            struct timespec ts;
+            clock_gettime( CLOCK_MONOTONIC, &ts );
+            return (uint32_t)ts.tv_sec * 1000000000UL + (uint32_t)ts.tv_nsec;
+        }
+    #endif
+
+        //Head of recorded histograms list, template to keep header only library with one definition
+        template< int DUMMY = 0 >
+        struct LatencyRegistry
+        {
+            static LatencyHistogram *Head;
+        };
+        template< int DUMMY >
+        LatencyHistogram *LatencyRegistry<DUMMY>::Head = 0;
+
+        //Per probe site histogram, TAG is the instrumented class and SITE is __LINE__ of the probe
+        template< class TAG, int SITE >
+        struct LatencyHistogramOf
+        {
+            static LatencyHistogram value;
+        };
+        template< class TAG, int SITE >
+        LatencyHistogram LatencyHistogramOf<TAG, SITE>::value;
+
+        //floor(log2(value)), 0 for 0
+        inline uint8_t LatencyBucket(uint32_t value)
+        {
+            uint8_t bucket;
+        #if defined(__GNUC__)
+            bucket = value ? (uint8_t)(sizeof(unsigned long) * 8 - 1 - __builtin_clzl( (unsigned long)value )) : 0;
+        #else
+            bucket = 0;
+            while( value >>= 1 )
+                ++bucket;
+        #endif
+            return bucket < TRIO_LATENCY_BUCKETS ? bucket : TRIO_LATENCY_BUCKETS - 1;
+        }
+    }//namespace Private
+
+    inline void LatencyRecord(LatencyHistogram &h, const char *name, uint32_t ticks)
+    {
+        if( !h.Name )
+        {
+            h.Name = name;
+            h.Next = Private::LatencyRegistry<>::Head;
+            Private::LatencyRegistry<>::Head = &h;
+        }
+        if( h.Count == 0 || ticks < h.Min )
+            h.Min = ticks;
+        if( ticks > h.Max )
+            h.Max = ticks;
+        if( h.Count != 0xFFFFFFFFUL )
+            ++h.Count;
+        ++h.Buckets[ Private::LatencyBucket( ticks ) ];
+    }
+
+    //Times its own lifetime
+    class LatencyScope
+    {
+    public:
+        LatencyScope(LatencyHistogram &h, const char *name): _h(h), _name(name), _start( (uint32_t)TRIO_LATENCY_COUNTER() ){ }
+        ~LatencyScope()
+        {
+            const uint32_t ticks = ((uint32_t)TRIO_LATENCY_COUNTER() - _start) & TRIO_LATENCY_COUNTER_MASK;
+            LatencyRecord( _h, _name, ticks );
+        }
+    private:
+        LatencyScope(const LatencyScope &);
+        LatencyScope &operator=(const LatencyScope &);
+
+        LatencyHistogram &_h;
+        const char *_name;
+        const uint32_t _start;
+    };
+
+    //Start cycle counter if it needs to be started
+    inline void LatencyInit()
+    {
+    #if defined(TRIO_LATENCY_DWT)
+        *(volatile uint32_t*)0xE000EDFCUL |= 1UL << 24;		//CoreDebug DEMCR.TRCENA
+        *(volatile uint32_t*)0xE0001FB0UL = 0xC5ACCE55UL;	//DWT_LAR unlock, Cortex-M7 only, ignored by others
+        *(volatile uint32_t*)0xE0001004UL = 0;				//DWT_CYCCNT
+        *(volatile uint32_t*)0xE0001000UL |= 1UL;			//DWT_CTRL.CYCCNTENA
+    #endif
+    }
+
+    //Call fn(const LatencyHistogram &) for each recorded histogram, most recently recorded first
+    template< class FN >
+    void LatencyDump(FN fn)
+    {
+        for( const LatencyHistogram *h = Private::LatencyRegistry<>::Head; h; h = h->Next )
+            fn( *h );
+    }
+
+    //Clear statistics of all recorded histograms, they stay in the list
+    inline void LatencyReset()
+    {
+        for( LatencyHistogram *h = Private::LatencyRegistry<>::Head; h; h = h->Next )
+        {
+            h->Count = h->Min = h->Max = 0;
+            for( uint8_t i = 0; i < TRIO_LATENCY_BUCKETS; ++i )
+                h->Buckets[i] = 0;
+        }
+    }
+}//namespace TRIO
+
+//Time from here to the end of enclosing scope. Function local histogram has no initializer, so no guard variable
+#define TRIO_LATENCY_REGION(NAME) \
+    static ::TRIO::LatencyHistogram trio_latency_histogram_; \
+    ::TRIO::LatencyScope trio_latency_scope_( trio_latency_histogram_, NAME )
+
+//Library probe: one histogram per instrumented class and probe line
+#define TRIO_LATENCY_PROBE(TAG, NAME) \
+    ::TRIO::LatencyScope trio_latency_probe_( ::TRIO::Private::LatencyHistogramOf< TAG, __LINE__ >::value, TRIO_LATENCY_FUNCTION(NAME) )
+
+#else
+
+namespace TRIO
+{
+    inline void LatencyInit(){ }
+    template< class FN >
+    void LatencyDump(FN){ }
+    inline void LatencyReset(){ }
+}
+
+#define TRIO_LATENCY_REGION(NAME)
+#define TRIO_LATENCY_PROBE(TAG, NAME)
+
+#endif//TRIO_LATENCY
+
+#endif//TRIO_LATENCY_HPP_
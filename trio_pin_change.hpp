@@ -0,0 +1,166 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Pin change event dispatcher. Handlers are bound to pins at compile time.
+// Dispatch() reads each port of bound pins once, XORs with previous state and calls handlers of changed pins only:
+// loop runs over set bits of changed mask(count trailing zeros) and handler is taken from constant table by bit index.
+// So interrupt cost depends on number of changed pins, not on number of bound pins.
+// Handler gets logical pin level(inverted pins are taken into account).
+//
+// Call Dispatch() from pin change interrupt of the port(s):
+// AVR		PCINTn_vect, port PCINT group is selected by TRIO_AVR_PCINT_x(see AVR port)
+// STM8		EXTI port vectors, edge sensitivity is set in EXTI_CR1/EXTI_CR2
+// XMEGA	PORTx_INT0_vect, pins are in INT0MASK, sense and INT0 level are set by HWSpecificAPI
+// Host		from test code after HWSpecificAPI::DriveInputs()
+// EnableInterrupts() enables interrupts of bound pins with Configure::EnableInterrupt of their ports.
+//
+// Usage example:
+// void OnStart(bool level);
+// void OnStop(bool level);
+// typedef PinChangeDispatcher< OnPinChange<Pb0, OnStart>, OnPinChange<Pb1Inv, OnStop> > Buttons;
+// Buttons::Init();
+// Buttons::EnableInterrupts();
+// ISR(PCINT0_vect){ Buttons::Dispatch(); }
+
+#ifndef TRIO_PIN_CHANGE_HPP_
+#define TRIO_PIN_CHANGE_HPP_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+#include <stdint.h>
+#include "loki/Typelist.h"
+#include "trio_pinlist_utils.hpp"
+#include "trio_pinlist.hpp"
+
+namespace TRIO
+{
+    typedef void (*PinChangeHandler)(bool level);
+
+    //Bind HANDLER to PIN
+    template< class PIN, PinChangeHandler HANDLER >
+    struct OnPinChange
+    {
+        typedef PIN Pin;
+        static void Handle(bool level){ HANDLER(level); }
+    };
+
+    namespace Private
+    {
+        template< class TList >
+        struct PinsOfBindings
+        {
+            typedef Loki::NullType Result;
+        };
+        template< class Head, class Tail >
+        struct PinsOfBindings< Loki::Typelist<Head, Tail> >
+        {
+            typedef Loki::Typelist< typename Head::Pin, typename PinsOfBindings<Tail>::Result >	Result;
+        };
+
+        /*Handlers table, index is pin position in PinList of bound pins
+        * BINDINGS list of OnPinChange*/
+        template< class BINDINGS, int LENGTH = Loki::TL::Length<BINDINGS>::value >
+        struct PinChangeHandlerTable;
+
+        #define TRIO_PIN_CHANGE_ENTRY(I)	&Loki::TL::TypeAt<BINDINGS, I>::Result::Handle
+        #define TRIO_PIN_CHANGE_TABLE(N)	\
+            template< class BINDINGS > \
+            struct PinChangeHandlerTable< BINDINGS, N >{ static const PinChangeHandler Table[N]; }; \
+            template< class BINDINGS > \
+            const PinChangeHandler PinChangeHandlerTable< BINDINGS, N >::Table[N] = { TRIO_TABLE_INIT_##N(TRIO_PIN_CHANGE_ENTRY) };
+
+        TRIO_TABLE_FOR_LENGTHS(TRIO_PIN_CHANGE_TABLE)
+
+        #undef TRIO_PIN_CHANGE_TABLE
+        #undef TRIO_PIN_CHANGE_ENTRY
+    }//namespace Private
+
+    template<
+        typename T1  = Loki::NullType, typename T2  = Loki::NullType, typename T3  = Loki::NullType,
+        typename T4  = Loki::NullType, typename T5  = Loki::NullType, typename T6  = Loki::NullType,
+        typename T7  = Loki::NullType, typename T8  = Loki::NullType, typename T9  = Loki::NullType,
+        typename T10 = Loki::NullType, typename T11 = Loki::NullType, typename T12 = Loki::NullType,
+        typename T13 = Loki::NullType, typename T14 = Loki::NullType, typename T15 = Loki::NullType,
+        typename T16 = Loki::NullType, typename T17 = Loki::NullType, typename T18 = Loki::NullType,
+        typename T19 = Loki::NullType, typename T20 = Loki::NullType, typename T21 = Loki::NullType,
+        typename T22 = Loki::NullType, typename T23 = Loki::NullType, typename T24 = Loki::NullType,
+        typename T25 = Loki::NullType, typename T26 = Loki::NullType, typename T27 = Loki::NullType,
+        typename T28 = Loki::NullType, typename T29 = Loki::NullType, typename T30 = Loki::NullType,
+        typename T31 = Loki::NullType, typename T32 = Loki::NullType >
+    class PinChangeDispatcher
+    {
+        typedef typename Loki::TL::Append<
+                    typename Loki::TL::MakeTypelist<T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16>::Result,
+                    typename Loki::TL::MakeTypelist<T17,T18,T19,T20,T21,T22,T23,T24,T25,T26,T27,T28,T29,T30,T31,T32>::Result
+                >::Result	Bindings;
+        typedef Private::PinChangeHandlerTable<Bindings> Handlers;
+
+    public:
+        //Bound pins, bit i of state and changed mask is pin of i-th binding
+        typedef typename Private::MakePinListFromTList< typename Private::PinsOfBindings<Bindings>::Result >::Result	Pins;
+        typedef typename Pins::DataT DataT;
+
+        //Take current pins state, no events are reported for it
+        static void Init(){ _state = Pins::Read(); }
+
+        static void EnableInterrupts(){ Pins::Configure::template EnableInterrupt<(DataT)~0>(); }
+        static void DisableInterrupts(){ Pins::Configure::template DisableInterrupt<(DataT)~0>(); }
+
+        //Call handlers of changed pins, returns changed mask
+        static DataT Dispatch()
+        {
+            const DataT state = Pins::Read();
+            const DataT changed = (DataT)(state ^ _state);
+            _state = state;
+
+            for( DataT rest = changed; rest; rest &= (DataT)(rest - 1) )
+            {
+                const uint8_t i = Private::Utils::CountTrailingZeros( rest );
+                Handlers::Table[i]( ((state >> i) & 1) != 0 );
+            }
+            return changed;
+        }
+
+        static DataT State(){ return _state; }
+
+    private:
+        static volatile DataT _state;
+    };
+
+    template< typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8,
+              typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15, typename T16,
+              typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23, typename T24,
+              typename T25, typename T26, typename T27, typename T28, typename T29, typename T30, typename T31, typename T32 >
+    volatile typename PinChangeDispatcher<T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16,
+                                          T17,T18,T19,T20,T21,T22,T23,T24,T25,T26,T27,T28,T29,T30,T31,T32>::DataT
+        PinChangeDispatcher<T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16,
+                            T17,T18,T19,T20,T21,T22,T23,T24,T25,T26,T27,T28,T29,T30,T31,T32>::_state = 0;
+}//namespace TRIO
+
+#endif//TRIO_PIN_CHANGE_HPP_
@@ -34,6 +34,10 @@
 * i.e. MultipinPort::Write(0x01); //will set Pd0 to 1, Pd1 = 0 Pd2 = 0 Pa2 = 0
 * uint8_t portdata = MultipinPort::Read();
 * 
+* PinList elements may be other PinLists and ports(also virtual ones implementing port API, like expander ports).
+* They are flattened to pins at compile time, so pins of the same port in different sub-buses are accessed at once.
+* typedef PinList<MultipinPort, Pd3, Portb> WideBus;	//Pd0, Pd1, Pd2, Pa2, Pd3, Pb0...Pb7
+* 
 * You can even pull pins from PinList by index and call TPin HWSpecific and extended API
 * Example:
 *  MultipinPort::GetPinByIndex<1>::Result::HWSpecificAPI::HWSpecificMethod(); */
@@ -60,6 +64,7 @@
 #include "loki/Typelist.h"
 #include "boost_static_assert.h"
 #include "trio_pinlist_utils.hpp"
+#include "trio_pinlist_index.hpp"
 
 namespace TRIO
 {
@@ -126,7 +131,7 @@ namespace TRIO
             typedef SettingsForSTM8 Settings;
         #elif defined(TRIO_STM32_PORT_)
             typedef SettingsForSTM32 Settings;
-        #elif defined(TRIO_AVR_PORT_)
+        #elif defined(TRIO_AVR_PORT_) || defined(TRIO_AVRXT_PORT_)
             typedef SettingsForAVR Settings;
         #elif defined(TRIO_XMEGA_PORT_)
             typedef SettingsForXMega Settings;
@@ -159,7 +164,8 @@ namespace TRIO
 			writeOP_Write,
 			writeOP_Set,
 			writeOP_Clear,
-			writeOP_Toggle
+			writeOP_Toggle,
+			writeOP_ClearAndSet     //used with RunII(clearMask, setMask)
 		} WriteOPs_enum;
 		
 		//rfReadValueFromPort handles all port read operations
@@ -188,6 +194,10 @@ namespace TRIO
 	    /*Return PinList in which pin is sitting. T meant to be TPinWrapper*/
         template< class T, class U=Loki::NullType, uint32_t N=0 >
         struct mfGetPinList{ typedef typename T::PinList Result; };
+
+        /*Return pin itself(unwrapped). T meant to be TPinWrapper*/
+        template< class T, class U=Loki::NullType, uint32_t N=0 >
+        struct mfGetPin{ typedef typename T::Pin Result; };
         //=========Meta functions returning type END=============
 
         //=========Predicates for conditional operations=============
@@ -195,6 +205,14 @@ namespace TRIO
         template < class T, class U=Loki::NullType, uint32_t N=0 >
         struct IfBelongsToPort{ enum{ value = Loki::IsSameType<typename mfGetPort<T>::Result, U>::value }; };
         
+		/*Return true if pin position in PinList is in range [N >> 8, N & 0xFF]. T meant to be TPinWrapper*/
+		template < class T, class U=Loki::NullType, uint32_t N=0 >
+        struct IfListPositionInRange{ enum{ value = T::ListPinNumber >= (N >> 8) && T::ListPinNumber <= (N & 0xFF) }; };
+
+		/*Return true if pin is present in PinList bit mask N. T meant to be TPinWrapper*/
+		template < class T, class U=Loki::NullType, uint32_t N=0 >
+        struct IfPinInListMask{ enum{ value = (N >> T::ListPinNumber) & 1 }; };
+
 		/*Return true if pin number in port is equal to pin number in PinList.
 		It means we need no shifts and masking to map pin number form list to port. I called this "direct mapping".*/
 		template < class T, class U=Loki::NullType, uint32_t N=0 >
@@ -434,59 +452,74 @@ namespace TRIO
         static const bool GrProc_WeAreReading = false;
         
 		/*LIST: list of pins participating in some serial group(we don't know yet one or more groups are there)
-        * recursively break this pins into groups and process each group.
-        * OP_TYPE is a flag to distinguish reading and writing, this affects shifting direction*/
-		template< class LIST, bool OP_TYPE >
-		struct SerialGroupsProcessor
+        * recursively break this pins into groups. Result is list of groups, each group is list of pins*/
+		template< class LIST >
+		struct SerialGroupsOf
+		{
+			//find group boundaries
+			typedef typename Utils::CopyUntil<LIST, IfPinHasLeftSerialNeighborExcept0, LIST>::Result	GroupOfSerialPins;
+			BOOST_STATIC_ASSERT( (Loki::TL::Length<GroupOfSerialPins>::value > 1) );
+
+			//throw away found group pins for next recursion
+			typedef Loki::Typelist< GroupOfSerialPins,
+                                    typename SerialGroupsOf< typename Utils::List1MinusList2<LIST, GroupOfSerialPins>::Result >::Result >	Result;
+		};
+
+		template<>
+		struct SerialGroupsOf< Loki::NullType >
+		{
+			typedef Loki::NullType Result;
+		};
+
+		/*Process one serial group of pins with one shift
+        * T group of pins
+        * N OP_TYPE is a flag to distinguish reading and writing, this affects shifting direction*/
+		template< class T, class U=Loki::NullType, uint32_t N=0, uint32_t M=0 >
+		struct rfProcessSerialGroup
 		{
 			PL_TEMPLATE_PRAGMA
 			template< class RtT, class RtU >
 			PL_INLINE_PRAGMA
-			static void Run(const RtT n, RtU &result)	//output parameter result
+			static void RunIO(const RtT n, RtU &result)	//output parameter result
 			{
-				//find group boundaries
-				typedef typename Utils::CopyUntil<LIST, IfPinHasLeftSerialNeighborExcept0, LIST>::Result	GroupOfSerialPins;
-				BOOST_STATIC_ASSERT( (Loki::TL::Length<GroupOfSerialPins>::value > 1) );
-
-				//group found, so process it
-				typedef typename Loki::TL::TypeAt< GroupOfSerialPins, 0>::Result	LeftmostPin;
+				typedef typename Loki::TL::TypeAt< T, 0>::Result	LeftmostPin;
 				const uint8_t PortPinNumber = LeftmostPin::Pin::TRIOInternals::PortPinNumber;
 				const uint8_t ListPinNumber = LeftmostPin::ListPinNumber;
 
-                if( OP_TYPE == GrProc_WeAreWriting )
+                if( N == GrProc_WeAreWriting )
                 {
                     //get exact return type from metafunction to prevent compiler warning
-                    const typename mfCalcPinListMask<LeftmostPin>::RetvalType MASK = Utils::metaForEach_bitOr<GroupOfSerialPins, mfCalcPinListMask>::value;
-                    const RtU MaskedWriteVal = n & MASK;
-                    result |= ( PortPinNumber < ListPinNumber )? MaskedWriteVal >> (ListPinNumber-PortPinNumber)
-                                                               : MaskedWriteVal << (PortPinNumber-ListPinNumber);
+                    const typename mfCalcPinListMask<LeftmostPin>::RetvalType MASK = Utils::metaForEach_bitOr<T, mfCalcPinListMask>::value;
+                    //shift in PinList value type, group may be above port width in the PinList
+                    const RtT MaskedWriteVal = n & MASK;
+                    result |= (RtU)(( PortPinNumber < ListPinNumber )? MaskedWriteVal >> (ListPinNumber-PortPinNumber)
+                                                                     : MaskedWriteVal << (PortPinNumber-ListPinNumber));
                 }
                 else
                 {
                     //get exact return type from metafunction to prevent compiler warning
-                    const typename mfCalcPortMask<LeftmostPin>::RetvalType MASK = Utils::metaForEach_bitOr<GroupOfSerialPins, mfCalcPortMask>::value;
+                    const typename mfCalcPortMask<LeftmostPin>::RetvalType MASK = Utils::metaForEach_bitOr<T, mfCalcPortMask>::value;
                     const RtU MaskedPortval = n & MASK;
                     result |= ( PortPinNumber < ListPinNumber )? MaskedPortval << (ListPinNumber-PortPinNumber)
                                                                : MaskedPortval >> (PortPinNumber-ListPinNumber);
                 }
-				
-				//throw away processed pins for next recursion
-				typedef typename Utils::List1MinusList2<LIST, GroupOfSerialPins>::Result		NextRecursionPinList;
-				//Next iteration(recursion)
-				SerialGroupsProcessor<NextRecursionPinList, OP_TYPE>::Run( n, result );
 			}
 		};
-		
-		template< bool OP_TYPE >
-		struct SerialGroupsProcessor< Loki::NullType, OP_TYPE >
-        {
-            PL_TEMPLATE_PRAGMA
+
+		/*LIST: list of pins participating in some serial group
+        * Groups are found at compile time and processed one by one with runForEach(flat in TRIO_FOLD_EXPRESSIONS mode)
+        * OP_TYPE is a flag to distinguish reading and writing, this affects shifting direction*/
+		template< class LIST, bool OP_TYPE >
+		struct SerialGroupsProcessor
+		{
+			PL_TEMPLATE_PRAGMA
 			template< class RtT, class RtU >
 			PL_INLINE_PRAGMA
-			static void Run(const RtT n, RtU &result){ }
+			static void Run(const RtT n, RtU &result)	//output parameter result
+			{
+				Utils::runForEach<typename SerialGroupsOf<LIST>::Result, rfProcessSerialGroup, Loki::NullType, OP_TYPE>::RunIO( n, result );
+			}
 		};
-
-
 		//===================Runtime functions. Use it with IO::Private::Utils::runForEach<> algorithm=================
 		
         //Bit by bit value to port projection
@@ -529,11 +562,28 @@ namespace TRIO
             typedef typename Utils::CopyIf<U, IfBelongsToPort, T>::Result		AllPinsOfThisPort;
             typedef PinsAndMasksForProcessing< AllPinsOfThisPort, PortDataT >	PinsForProcessing;
 
+            static const PortDataT INVMASK = PinsForProcessing::INVMASK;
+            static const PortDataT PORTMASK = PinsForProcessing::PORTMASK;
+            //Only one pin of this port is in PinList, so compile time single pin operations are used(SBI/CBI, bit-band...)
+            static const bool SINGLE_PIN = Utils::PopBits<PORTMASK>::value == 1;
+
+            //Single pin: set or clear port bit
+            PL_INLINE_PRAGMA
+            static void WritePortBit(const bool level)
+            {
+                if( level )
+                    T::template Set<PORTMASK>();
+                else
+                    T::template Clear<PORTMASK>();
+            }
+
         public:
+            /*Map PinList value to port value. Inverted pins are NOT taken into account here.
+            * Public because runtime configuration maps PinList masks with the same planner*/
             PL_TEMPLATE_PRAGMA
             template< class RtT >
 			PL_INLINE_PRAGMA
-            static void RunI(const RtT ValToWrite) //I - 1Input params
+            static PortDataT MapValue(const RtT ValToWrite)
             {
                 PortDataT GonnaWriteToPort = 0;
 
@@ -547,29 +597,84 @@ namespace TRIO
                 //Process rest of pins using bit by bit mapping
                 Utils::runForEach<typename PinsForProcessing::BitByBitMapperPins, rfMapPinListValueToPort>::RunIO( ValToWrite, GonnaWriteToPort );
 
-                //Take into account inverted pins
-                GonnaWriteToPort ^= PinsForProcessing::INVMASK;
+                return GonnaWriteToPort;
+            }
+
+        private:
+            /*One port ClearAndSet for already mapped masks.
+            * Clearing inverted pin means setting port bit and vice versa, so clear and set masks are swapped for inverted pins.
+            * Set wins if pin is in both masks, like it is for port ClearAndSet*/
+            PL_INLINE_PRAGMA
+            static void ClearAndSetMapped(const PortDataT clearMask, const PortDataT setMask)
+            {
+                if( SINGLE_PIN )
+                {
+                    if( setMask )
+                        WritePortBit( INVMASK == 0 );
+                    else if( clearMask )
+                        WritePortBit( INVMASK != 0 );
+                }
+                else if( INVMASK == 0 )
+                    T::ClearAndSet( clearMask, setMask );
+                else
+                    T::ClearAndSet( (PortDataT)((clearMask & ~INVMASK) | (setMask & INVMASK)),
+                                    (PortDataT)((setMask & ~INVMASK) | (clearMask & ~setMask & INVMASK)) );
+            }
+
+        public:
+            PL_TEMPLATE_PRAGMA
+            template< class RtT >
+			PL_INLINE_PRAGMA
+            static void RunI(const RtT ValToWrite) //I - 1Input params
+            {
+                const PortDataT GonnaWriteToPort = MapValue( ValToWrite );
 
                 switch( static_cast<WriteOPs_enum>(OP_TYPE) )
                 {
                 case writeOP_Write:
 						//Whole port write optimization
-						if( Utils::PopBits<PinsForProcessing::PORTMASK>::value == T::Width )
-							T::Write( GonnaWriteToPort );
+						if( SINGLE_PIN )
+                            WritePortBit( ((GonnaWriteToPort ^ INVMASK) & PORTMASK) != 0 );
+						else if( Utils::PopBits<PinsForProcessing::PORTMASK>::value == T::Width )
+							T::Write( GonnaWriteToPort ^ INVMASK );
 						else
-							T::ClearAndSet( PinsForProcessing::PORTMASK, GonnaWriteToPort );
+							T::ClearAndSet( PinsForProcessing::PORTMASK, GonnaWriteToPort ^ INVMASK );
 						break;
                 case writeOP_Set:
-                        T::Set( GonnaWriteToPort );
+                        if( INVMASK == 0 && !SINGLE_PIN )
+                            T::Set( GonnaWriteToPort );
+                        else
+                            ClearAndSetMapped( 0, GonnaWriteToPort );
 						break;
                 case writeOP_Clear:
-                        T::Clear( GonnaWriteToPort );
+                        if( INVMASK == 0 && !SINGLE_PIN )
+                            T::Clear( GonnaWriteToPort );
+                        else
+                            ClearAndSetMapped( GonnaWriteToPort, 0 );
 						break;
                 case writeOP_Toggle:
-                        T::Toggle( GonnaWriteToPort );
+                        if( !SINGLE_PIN )
+                            T::Toggle( GonnaWriteToPort );  //toggle doesn't care about inversion
+                        else if( GonnaWriteToPort )
+                            T::template Toggle<PORTMASK>();
 						break;
+                default:
+                        break;
                 }
             }//static void RunI(const RtT ValToWrite)
+
+            /*ClearAndSet in one port operation. Both masks are mapped before port is touched,
+            * so with TRIO_RMW_POLICY only one short critical section per port is made*/
+            PL_TEMPLATE_PRAGMA
+            template< class RtT, class RtU >
+			PL_INLINE_PRAGMA
+            static void RunII(const RtT clearMask, const RtU setMask) //II - 2Input params
+            {
+                const PortDataT PortClearMask = MapValue( clearMask );
+                const PortDataT PortSetMask = MapValue( setMask );
+                if( PortClearMask || PortSetMask )	//port is not touched if none of its pins is in masks
+                    ClearAndSetMapped( PortClearMask, PortSetMask );
+            }
         };//struct rfWriteValueToPort
 
         /*T Port
@@ -592,7 +697,10 @@ namespace TRIO
                 PortDataT ValueReadedFromPort;
                 switch( static_cast<ReadOPs_enum>(OP_TYPE) )
                 {                    
-                    case readOP_Read:		ValueReadedFromPort = T::Read();
+                    case readOP_Read:		if( Utils::PopBits<PinsForProcessing::PORTMASK>::value == 1 )   //single pin of this port
+                                                ValueReadedFromPort = T::template Read<PinsForProcessing::PORTMASK>();
+                                            else
+                                                ValueReadedFromPort = T::Read();
 											break;
 					case readOP_ReadOutReg: ValueReadedFromPort = T::ReadOutReg();
 											break;
@@ -863,8 +971,9 @@ namespace TRIO
         {
             static const ConfigOPS_enum ConfOp = static_cast<ConfigOPS_enum>(M);
             typedef typename Utils::CopyIf<U, IfBelongsToPort, T>::Result		AllPinsOfThisPort;
+            typedef typename Utils::CopyIf<AllPinsOfThisPort, IfPinInListMask, Loki::NullType, N>::Result		PinsToConfigure;
 			
-            static const uint8_t COUNT_OF_PINS_TO_CONFIGURE = Loki::TL::Length<AllPinsOfThisPort>::value;
+            static const uint8_t COUNT_OF_PINS_TO_CONFIGURE = Loki::TL::Length<PinsToConfigure>::value;
             
 			//map PinList mask to port mask
             static const typename T::DataT CONFMASK = Utils::metaForEach_bitOr<AllPinsOfThisPort, mfPinListMaskToPortMask, Loki::NullType, N>::value;
@@ -872,7 +981,7 @@ namespace TRIO
             //Compile time select config strategy depending on settings and count of pins to configure
             typedef typename Loki::Select< (COUNT_OF_PINS_TO_CONFIGURE >= Settings::ConfGrSizeMetric),
                                             ConfStrategy_ByMask<T, CONFMASK, ConfOp>,				//big groups of pins configure by mask
-                                            ConfStrategy_IndividualPin<AllPinsOfThisPort, ConfOp>	//small groups by calling individual pin config methods
+                                            ConfStrategy_IndividualPin<PinsToConfigure, ConfOp>	//small groups by calling individual pin config methods
                                              >::Result		ConfigPortImplementation;
         public:
             PL_INLINE_PRAGMA
@@ -882,9 +991,55 @@ namespace TRIO
 														//because ConfigPortImplementation is already instantiated with template parameters(see above)
             }//static void Run()
         };//struct rfConfigurePort
+
+        /* Runtime mask port configuration
+        *  PinList mask is mapped to port mask the same way values are mapped by Write(direct, serial groups, bit by bit),
+        *  then one masked configuration of the port is made. Port is not touched if none of its pins is in the mask.
+        * T Port
+        * U List of pins wrapped in TPinWrapper
+        * M Config operation(ConfigOPS_enum) */
+        template< class T, class U=Loki::NullType, uint32_t N=0, uint32_t M=0 >
+        class rfConfigurePortByMask
+        {
+            typedef typename T::DataT PortDataT;
+        public:
+            PL_TEMPLATE_PRAGMA
+            template< class RtT >
+			PL_INLINE_PRAGMA
+            static void RunI(const RtT mask) //I - 1Input params
+            {
+                const PortDataT PortMask = rfWriteValueToPort<T, U>::MapValue( mask );
+                if( !PortMask )
+                    return;
+
+                switch( static_cast<ConfigOPS_enum>(M) )
+                {
+                case configOP_OutPushPull_Slow:	T::Configure::OutPushPull_Slow( PortMask ); break;
+                case configOP_OutPushPull_Medium:	T::Configure::OutPushPull_Medium( PortMask ); break;
+                case configOP_OutPushPull_Fast:	T::Configure::OutPushPull_Fast( PortMask ); break;
+                case configOP_OutOpenDrain_Slow:	T::Configure::OutOpenDrain_Slow( PortMask ); break;
+                case configOP_OutOpenDrain_Medium:	T::Configure::OutOpenDrain_Medium( PortMask ); break;
+                case configOP_OutOpenDrain_Fast:	T::Configure::OutOpenDrain_Fast( PortMask ); break;
+                case configOP_InFloating:	T::Configure::InFloating( PortMask ); break;
+                case configOP_InPullUp:	T::Configure::InPullUp( PortMask ); break;
+                case configOP_InPullDown:	T::Configure::InPullDown( PortMask ); break;
+                case configOP_InAnalog:	T::Configure::InAnalog( PortMask ); break;
+                case configOP_EnableAF:	T::Configure::EnableAF( PortMask ); break;
+                case configOP_DisableAF:	T::Configure::DisableAF( PortMask ); break;
+                case configOP_EnableInterrupt:	T::Configure::EnableInterrupt( PortMask ); break;
+                case configOP_DisableInterrupt:	T::Configure::DisableInterrupt( PortMask ); break;
+                default:
+                        break;
+                }
+            }//static void RunI(const RtT mask)
+        };//struct rfConfigurePortByMask
 		//===================Runtime functions. Use it with runForEach<> algorithm  END=================
 
 
+        //PinList of WIDTH pins starting at FROM position. See trio_pinlist_slicing.hpp
+        template< class TPINLIST, uint8_t FROM, uint8_t WIDTH >
+        struct PinListField;
+
         //PinListImplementation should respect Port API interface
         template< class TPINLIST >
         class PinListImplementation
@@ -896,12 +1051,23 @@ namespace TRIO
 						typename Loki::Select<(Loki::TL::Length<TPINLIST>::value > 16), uint32_t, uint16_t>::Result, uint8_t>::Result	DataT;
 
     		static const uint8_t Width = sizeof(DataT) * CHAR_BITS;
+            BOOST_STATIC_ASSERT( Loki::TL::Length<TPINLIST>::value <= 32 );	//Also after nested PinLists and ports are flattened
+            static const uint8_t Length = Loki::TL::Length<TPINLIST>::value;	//Number of pins
+
+            //Pins wrapped in TPinWrapper and ports used by PinList. For extensions that need to walk over pins or ports
+            typedef TPINLIST WrappedPins;
+            typedef UniquePortsList Ports;
 
     		//Main runtime API======================
-            static void Write(DataT value){ Utils::runForEach<UniquePortsList, rfWriteValueToPort, TPINLIST, writeOP_Write>::RunI( value ); }
+            static void Write(DataT value)
+            {
+                TRIO_LATENCY_PROBE( PinListImplementation, "PinList::Write" );
+                Utils::runForEach<UniquePortsList, rfWriteValueToPort, TPINLIST, writeOP_Write>::RunI( value );
+            }
             
 			static DataT Read()
             {
+                TRIO_LATENCY_PROBE( PinListImplementation, "PinList::Read" );
                 DataT RetVal = 0;
                 Utils::runForEach<UniquePortsList, rfReadValueFromPort, TPINLIST, readOP_Read>::RunO( RetVal );
                 return RetVal;
@@ -909,21 +1075,47 @@ namespace TRIO
             
 			static DataT ReadOutReg()
             {
+                TRIO_LATENCY_PROBE( PinListImplementation, "PinList::ReadOutReg" );
                 DataT RetVal = 0;
                 Utils::runForEach<UniquePortsList, rfReadValueFromPort, TPINLIST, readOP_ReadOutReg>::RunO( RetVal );
                 return RetVal;
             }
             
-			static void Set(DataT mask){	Utils::runForEach<UniquePortsList, rfWriteValueToPort, TPINLIST, writeOP_Set>::RunI( mask ); }
-            static void Clear(DataT mask){	Utils::runForEach<UniquePortsList, rfWriteValueToPort, TPINLIST, writeOP_Clear>::RunI( mask ); }
+			static void Set(DataT mask)
+            {
+                TRIO_LATENCY_PROBE( PinListImplementation, "PinList::Set" );
+                Utils::runForEach<UniquePortsList, rfWriteValueToPort, TPINLIST, writeOP_Set>::RunI( mask );
+            }
+
+            static void Clear(DataT mask)
+            {
+                TRIO_LATENCY_PROBE( PinListImplementation, "PinList::Clear" );
+                Utils::runForEach<UniquePortsList, rfWriteValueToPort, TPINLIST, writeOP_Clear>::RunI( mask );
+            }
             
 			static void ClearAndSet(DataT clearMask, DataT setmask)
             {
-				Utils::runForEach<UniquePortsList, rfWriteValueToPort, TPINLIST, writeOP_Clear>::RunI( clearMask );
-                Utils::runForEach<UniquePortsList, rfWriteValueToPort, TPINLIST, writeOP_Set>::RunI( setmask );
+                TRIO_LATENCY_PROBE( PinListImplementation, "PinList::ClearAndSet" );
+				Utils::runForEach<UniquePortsList, rfWriteValueToPort, TPINLIST, writeOP_ClearAndSet>::RunII( clearMask, setmask );
             }
             
-			static void Toggle(DataT mask){ Utils::runForEach<UniquePortsList, rfWriteValueToPort, TPINLIST, writeOP_Toggle>::RunI( mask ); }
+			static void Toggle(DataT mask)
+            {
+                TRIO_LATENCY_PROBE( PinListImplementation, "PinList::Toggle" );
+                Utils::runForEach<UniquePortsList, rfWriteValueToPort, TPINLIST, writeOP_Toggle>::RunI( mask );
+            }
+
+            //Write or read WIDTH bits field starting at FROM pin. Only ports of field pins are touched
+            template< uint8_t FROM, uint8_t WIDTH >
+            static void WriteField(DataT value){ PinListField<TPINLIST, FROM, WIDTH>::Result::Write( value ); }
+            template< uint8_t FROM, uint8_t WIDTH >
+            static DataT ReadField(){ return PinListField<TPINLIST, FROM, WIDTH>::Result::Read(); }
+
+            //Runtime indexed pin access, index must be less than Length. One table load and one port operation
+            static void SetPin(uint8_t i){		const PinIndexEntry &pin = PinIndexTable<TPINLIST>::Table[i]; pin.Port->Set( pin.Mask ); }
+            static void ClearPin(uint8_t i){	const PinIndexEntry &pin = PinIndexTable<TPINLIST>::Table[i]; pin.Port->Clear( pin.Mask ); }
+            static void TogglePin(uint8_t i){	const PinIndexEntry &pin = PinIndexTable<TPINLIST>::Table[i]; pin.Port->Toggle( pin.Mask ); }
+            static bool ReadPin(uint8_t i){		const PinIndexEntry &pin = PinIndexTable<TPINLIST>::Table[i]; return (pin.Port->Read() & pin.Mask) != 0; }
 
             //Main compile time static API==================
             template<DataT value>
@@ -973,6 +1165,24 @@ namespace TRIO
                 static void EnableInterrupt(){ Utils::runForEach<UniquePortsList, rfConfigurePort, TPINLIST, MASK, configOP_EnableInterrupt>::Run(); }
                 template<DataT MASK>
                 static void DisableInterrupt(){ Utils::runForEach<UniquePortsList, rfConfigurePort, TPINLIST, MASK, configOP_DisableInterrupt>::Run(); }
+
+                //Same configurations with runtime mask. One masked configuration per port
+                static void OutPushPull_Slow(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_OutPushPull_Slow>::RunI( mask ); }
+                static void OutPushPull_Medium(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_OutPushPull_Medium>::RunI( mask ); }
+                static void OutPushPull_Fast(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_OutPushPull_Fast>::RunI( mask ); }
+                static void OutOpenDrain_Slow(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_OutOpenDrain_Slow>::RunI( mask ); }
+                static void OutOpenDrain_Medium(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_OutOpenDrain_Medium>::RunI( mask ); }
+                static void OutOpenDrain_Fast(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_OutOpenDrain_Fast>::RunI( mask ); }
+
+                static void InFloating(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_InFloating>::RunI( mask ); }
+                static void InPullUp(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_InPullUp>::RunI( mask ); }
+                static void InPullDown(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_InPullDown>::RunI( mask ); }
+                static void InAnalog(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_InAnalog>::RunI( mask ); }
+
+                static void EnableAF(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_EnableAF>::RunI( mask ); }
+                static void DisableAF(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_DisableAF>::RunI( mask ); }
+                static void EnableInterrupt(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_EnableInterrupt>::RunI( mask ); }
+                static void DisableInterrupt(DataT mask){ Utils::runForEach<UniquePortsList, rfConfigurePortByMask, TPINLIST, 0, configOP_DisableInterrupt>::RunI( mask ); }
             };
             //=============Hardware specific API for maximum flexibility======================
             //TPin public interface will be extended by this hardware specific API
@@ -1002,10 +1212,53 @@ namespace TRIO
 			static const uint8_t ListPinNumber = POSITION;
 		};
 
-        //Generate list of wrappers with positions
+        //Kind of PinList element
+        enum{ elemNone, elemPin, elemPinList, elemPort };
+
+        template< class T >
+        class PinListElementKind
+        {
+            typedef char Yes;
+            typedef long No;
+            template< class U > static Yes TestPinList(typename U::WrappedPins *);
+            template< class U > static No TestPinList(...);
+            template< class U > static Yes TestPin(typename U::TRIOInternals *);
+            template< class U > static No TestPin(...);
+        public:
+            static const int value = sizeof(TestPinList<T>(0)) == sizeof(Yes) ? elemPinList :
+                                     sizeof(TestPin<T>(0)) == sizeof(Yes) ? elemPin : elemPort;
+        };
+        template<>
+        class PinListElementKind< Loki::NullType >
+        {
+        public:
+            static const int value = elemNone;
+        };
+
+        //All pins of port, virtual ports(expanders etc.) should implement port API
+        template< class PORT, uint8_t PIN = 0, bool END = (PIN >= PORT::Width) >
+        struct PortPins
+        {
+            typedef Loki::Typelist< TPin<PORT, PIN>, typename PortPins<PORT, PIN + 1>::Result >	Result;
+        };
+        template< class PORT, uint8_t PIN >
+        struct PortPins< PORT, PIN, true >
+        {
+            typedef Loki::NullType Result;
+        };
+
+        //Pins of PinList element. Nested PinList is flattened to its pins, port is expanded to all of its pins
+        template< class T, int KIND = PinListElementKind<T>::value >
+        struct PinListElementPins{ typedef Loki::NullType Result; };
+        template< class T >
+        struct PinListElementPins< T, elemPin >{ typedef Loki::Typelist<T, Loki::NullType> Result; };
+        template< class T >
+        struct PinListElementPins< T, elemPinList >{ typedef typename Utils::metaForEach_TList<typename T::WrappedPins, mfGetPin>::Result Result; };
+        template< class T >
+        struct PinListElementPins< T, elemPort >{ typedef typename PortPins<T>::Result Result; };
+
+        //Flatten PinList elements to list of pins
         template<
-            class PinListT,
-            uint8_t Position,
             typename T1  = Loki::NullType, typename T2  = Loki::NullType, typename T3  = Loki::NullType,
             typename T4  = Loki::NullType, typename T5  = Loki::NullType, typename T6  = Loki::NullType,
             typename T7  = Loki::NullType, typename T8  = Loki::NullType, typename T9  = Loki::NullType,
@@ -1017,25 +1270,34 @@ namespace TRIO
 			typename T25 = Loki::NullType, typename T26 = Loki::NullType, typename T27 = Loki::NullType,
 			typename T28 = Loki::NullType, typename T29 = Loki::NullType, typename T30 = Loki::NullType,
 			typename T31 = Loki::NullType, typename T32 = Loki::NullType, typename T33 = Loki::NullType >
-        class MakeWrappedPinList
+        struct FlattenPinListElements
         {
-            typedef typename MakeWrappedPinList<
-				PinListT, Position + 1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16,
-                T17, T18, T19, T20, T21, T22, T23, T24, T25, T26, T27, T28, T29, T30, T31, T32, T33
-            >::Result	TailResult;
-			
-			enum{ 
-				PositionInList = Position 
-				};        
-		public:
-            typedef Loki::Typelist< TPinWrapper<T1, PinListT, PositionInList>, TailResult>	Result;
-        };//class MakeWrappedPinList
-       
-	    template< class PinListT, uint8_t Position >
-        struct MakeWrappedPinList< PinListT, Position > 
-		{ 
-			typedef Loki::NullType Result; 
-		};
+            typedef typename Loki::TL::Append<
+                typename PinListElementPins<T1>::Result,
+                typename FlattenPinListElements<
+                    T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16,
+                    T17, T18, T19, T20, T21, T22, T23, T24, T25, T26, T27, T28, T29, T30, T31, T32, T33 >::Result
+            >::Result	Result;
+        };
+
+        template<>
+        struct FlattenPinListElements<>
+        {
+            typedef Loki::NullType Result;
+        };
+
+        //Generate list of wrappers with positions
+        template< class PinListT, class TList, uint8_t Position = 0 >
+        struct MakeWrappedPinList
+        {
+            typedef Loki::NullType Result;
+        };
+
+        template< class PinListT, class Head, class Tail, uint8_t Position >
+        struct MakeWrappedPinList< PinListT, Loki::Typelist<Head, Tail>, Position >
+        {
+            typedef Loki::Typelist< TPinWrapper<Head, PinListT, Position>, typename MakeWrappedPinList<PinListT, Tail, Position + 1>::Result >	Result;
+        };
     
 	}//namespace Private
 
@@ -1058,8 +1320,9 @@ namespace TRIO
                     PinList<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16, T17,
                             T18, T19, T20, T21, T22, T23, T24, T25, T26, T27, T28, T29, T30, T31, T32, T33>,
 
-                      0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16, T17,
-                    T18, T19, T20, T21, T22, T23, T24, T25, T26, T27, T28, T29, T30, T31, T32, T33>::Result >
+                    //Nested PinLists and ports are flattened to pins, so pins of same port are planned together
+                    typename Private::FlattenPinListElements<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16, T17,
+                    T18, T19, T20, T21, T22, T23, T24, T25, T26, T27, T28, T29, T30, T31, T32, T33>::Result >::Result >
     {		
 	};//struct PinList
 }
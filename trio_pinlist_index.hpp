@@ -0,0 +1,146 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Runtime indexed access to PinList pins: SetPin(i), ClearPin(i), TogglePin(i), ReadPin(i).
+// For each PinList a constant table of (port, mask) entries is generated at compile time, one entry per pin.
+// Port is a table of port operations with runtime mask. Inverted pins point to port operations with
+// Set/Clear swapped and inverted Read, so there is no inversion check at runtime.
+// Each call is a table load plus one port operation, no loop or switch over pins or ports.
+//
+// Usage example:
+// typedef PinList<Pa0, Pb3Inv, Pc7> Channels;
+// for( uint8_t ch = 0; ch < Channels::Length; ch++ )
+//     Channels::TogglePin( ch );
+
+#ifndef TRIO_PINLIST_INDEX_HPP_
+#define TRIO_PINLIST_INDEX_HPP_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+#include <stdint.h>
+#include "loki/Typelist.h"
+#include "trio_pinlist_utils.hpp"
+
+namespace TRIO
+{
+    namespace Private
+    {
+        //Port operations with runtime mask. Wide enough for any port
+        struct PinIndexPortOps
+        {
+            void (*Set)(uint32_t mask);
+            void (*Clear)(uint32_t mask);
+            void (*Toggle)(uint32_t mask);
+            uint32_t (*Read)();
+            uint8_t Width;		//Port width, pins are 0..Width-1
+        };
+
+        template< class PORT, bool INVERTED >
+        struct PinIndexPortOpsOf
+        {
+            typedef typename PORT::DataT DataT;
+            static void Set(uint32_t mask){ PORT::Set( (DataT)mask ); }
+            static void Clear(uint32_t mask){ PORT::Clear( (DataT)mask ); }
+            static void Toggle(uint32_t mask){ PORT::Toggle( (DataT)mask ); }
+            static uint32_t Read(){ return PORT::Read(); }
+
+            static const PinIndexPortOps value;
+        };
+
+        //Inverted pin: set is port clear and vice versa
+        template< class PORT >
+        struct PinIndexPortOpsOf< PORT, true >
+        {
+            typedef typename PORT::DataT DataT;
+            static void Set(uint32_t mask){ PORT::Clear( (DataT)mask ); }
+            static void Clear(uint32_t mask){ PORT::Set( (DataT)mask ); }
+            static void Toggle(uint32_t mask){ PORT::Toggle( (DataT)mask ); }
+            static uint32_t Read(){ return ~(uint32_t)PORT::Read(); }
+
+            static const PinIndexPortOps value;
+        };
+
+        template< class PORT, bool INVERTED >
+        const PinIndexPortOps PinIndexPortOpsOf<PORT, INVERTED>::value =
+        {
+            &PinIndexPortOpsOf<PORT, INVERTED>::Set,
+            &PinIndexPortOpsOf<PORT, INVERTED>::Clear,
+            &PinIndexPortOpsOf<PORT, INVERTED>::Toggle,
+            &PinIndexPortOpsOf<PORT, INVERTED>::Read,
+            PORT::Width
+        };
+
+        template< class PORT >
+        const PinIndexPortOps PinIndexPortOpsOf<PORT, true>::value =
+        {
+            &PinIndexPortOpsOf<PORT, true>::Set,
+            &PinIndexPortOpsOf<PORT, true>::Clear,
+            &PinIndexPortOpsOf<PORT, true>::Toggle,
+            &PinIndexPortOpsOf<PORT, true>::Read,
+            PORT::Width
+        };
+
+        //One table entry: pin's port and pin mask in that port
+        struct PinIndexEntry
+        {
+            const PinIndexPortOps *Port;
+            uint32_t Mask;
+        };
+
+        /*Port operations and port mask of I-th pin of PinList
+        * TPINLIST List of pins wrapped in TPinWrapper*/
+        template< class TPINLIST, int I >
+        struct PinIndexEntryOf
+        {
+            typedef typename Loki::TL::TypeAt<TPINLIST, I>::Result::Pin		Pin;
+            typedef PinIndexPortOpsOf< typename Pin::TRIOInternals::Port, Pin::TRIOInternals::Inverted >	Ops;
+            static const uint32_t Mask = (uint32_t)1U << Pin::TRIOInternals::PortPinNumber;
+        };
+
+        /*Table of PinList pins. Table size must match initializer list, so table is specialized for each PinList length(see TRIO_TABLE_FOR_LENGTHS).
+        * TPINLIST List of pins wrapped in TPinWrapper
+        * LENGTH Number of pins in PinList*/
+        template< class TPINLIST, int LENGTH = Loki::TL::Length<TPINLIST>::value >
+        struct PinIndexTable;
+
+        #define TRIO_PIN_INDEX_ENTRY(I)		{ &PinIndexEntryOf<TPINLIST, I>::Ops::value, PinIndexEntryOf<TPINLIST, I>::Mask }
+        #define TRIO_PIN_INDEX_TABLE(N)	\
+            template< class TPINLIST > \
+            struct PinIndexTable< TPINLIST, N >{ static const PinIndexEntry Table[N]; }; \
+            template< class TPINLIST > \
+            const PinIndexEntry PinIndexTable< TPINLIST, N >::Table[N] = { TRIO_TABLE_INIT_##N(TRIO_PIN_INDEX_ENTRY) };
+
+        TRIO_TABLE_FOR_LENGTHS(TRIO_PIN_INDEX_TABLE)
+
+        #undef TRIO_PIN_INDEX_TABLE
+        #undef TRIO_PIN_INDEX_ENTRY
+    }//namespace Private
+}//namespace TRIO
+
+#endif//TRIO_PINLIST_INDEX_HPP_
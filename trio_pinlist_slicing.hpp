@@ -0,0 +1,120 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// PinList type operators. New PinLists are made of pins of existing ones(selected by PinList positions),
+// so sub-buses need not be declared pin by pin once again.
+// SubList<PL, FROM, TO>::Result	PinList of PL pins at positions FROM..TO(inclusive)
+// Concat<PL1, PL2>::Result			PinList of PL1 pins followed by PL2 pins
+// Field<PL, FROM, WIDTH>			Named bitfield of PL, it is a PinList of WIDTH pins starting at FROM position
+//
+// Field write is made by field PinList, so only ports of field pins are touched and only field pins are written.
+// Usage example:
+// typedef PinList<Pa0, Pa1, Pa2, Pa3, Pb0, Pb1, Pb2, Pc5> Bus;
+// typedef Field<Bus, 4, 3> Cmd;				//Pb0..Pb2
+// Cmd::Write( 5 );							//one port B ClearAndSet, same as Bus::WriteField<4, 3>( 5 )
+// typedef Concat< SubList<Bus, 0, 3>::Result, PinList<Pc5> >::Result Addr;
+
+#ifndef TRIO_PINLIST_SLICING_HPP_
+#define TRIO_PINLIST_SLICING_HPP_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+#include <stdint.h>
+#include "loki/Typelist.h"
+#include "boost_static_assert.h"
+#include "trio_pinlist.hpp"
+
+namespace TRIO
+{
+    namespace Private
+    {
+        //Make PinList of pins from typelist
+        template< class TList >
+        class MakePinListFromTList
+        {
+            BOOST_STATIC_ASSERT( Loki::TL::Length<TList>::value <= 32 );
+
+            template< unsigned int I >
+            struct At{ typedef typename Loki::TL::TypeAtNonStrict<TList, I, Loki::NullType>::Result Result; };
+        public:
+            typedef PinList<
+                typename At<0>::Result,  typename At<1>::Result,  typename At<2>::Result,  typename At<3>::Result,
+                typename At<4>::Result,  typename At<5>::Result,  typename At<6>::Result,  typename At<7>::Result,
+                typename At<8>::Result,  typename At<9>::Result,  typename At<10>::Result, typename At<11>::Result,
+                typename At<12>::Result, typename At<13>::Result, typename At<14>::Result, typename At<15>::Result,
+                typename At<16>::Result, typename At<17>::Result, typename At<18>::Result, typename At<19>::Result,
+                typename At<20>::Result, typename At<21>::Result, typename At<22>::Result, typename At<23>::Result,
+                typename At<24>::Result, typename At<25>::Result, typename At<26>::Result, typename At<27>::Result,
+                typename At<28>::Result, typename At<29>::Result, typename At<30>::Result, typename At<31>::Result >	Result;
+        };
+
+        //Pins(unwrapped) of wrapped pins list at positions FROM..TO
+        template< class TPINLIST, uint8_t FROM, uint8_t TO >
+        struct PinsInRange
+        {
+            BOOST_STATIC_ASSERT( FROM <= TO && TO < Loki::TL::Length<TPINLIST>::value );
+
+            typedef typename Utils::metaForEach_TList<
+                        typename Utils::CopyIf<TPINLIST, IfListPositionInRange, Loki::NullType, ((uint32_t)FROM << 8) | TO>::Result,
+                        mfGetPin >::Result	Result;
+        };
+
+        template< class TPINLIST, uint8_t FROM, uint8_t WIDTH >
+        struct PinListField
+        {
+            BOOST_STATIC_ASSERT( WIDTH > 0 );
+            typedef typename MakePinListFromTList< typename PinsInRange<TPINLIST, FROM, FROM + WIDTH - 1>::Result >::Result	Result;
+        };
+    }//namespace Private
+
+    template< class PL, uint8_t FROM, uint8_t TO >
+    struct SubList
+    {
+        typedef typename Private::MakePinListFromTList< typename Private::PinsInRange<typename PL::WrappedPins, FROM, TO>::Result >::Result	Result;
+    };
+
+    template< class PL1, class PL2 >
+    struct Concat
+    {
+        typedef typename Private::MakePinListFromTList<
+                    typename Loki::TL::Append<
+                        typename Private::Utils::metaForEach_TList<typename PL1::WrappedPins, Private::mfGetPin>::Result,
+                        typename Private::Utils::metaForEach_TList<typename PL2::WrappedPins, Private::mfGetPin>::Result
+                    >::Result >::Result		Result;
+    };
+
+    template< class PL, uint8_t FROM, uint8_t WIDTH >
+    struct Field: public Private::PinListField<typename PL::WrappedPins, FROM, WIDTH>::Result
+    {
+        typedef PL Parent;
+        static const uint8_t Offset = FROM;
+    };
+}//namespace TRIO
+
+#endif//TRIO_PINLIST_SLICING_HPP_
@@ -31,6 +31,19 @@
 #include "loki/Typelist.h"
 #include "boost_static_assert.h"
 
+/*C++17 fold expressions mode of runForEach.
+* Recursive runForEach is one nested call per list element and relies on PL_INLINE_PRAGMA to be flattened.
+* In debug builds(-O0, -Og) or with compiler inlining limits PinList operations become chains of nested calls.
+* In fold mode runForEach expands Fn calls for all elements in one function body.
+* Enabled by default for C++17, define TRIO_FOLD_EXPRESSIONS to 0 or 1 to override*/
+#ifndef TRIO_FOLD_EXPRESSIONS
+    #if __cplusplus >= 201703L
+        #define TRIO_FOLD_EXPRESSIONS 1
+    #else
+        #define TRIO_FOLD_EXPRESSIONS 0
+    #endif
+#endif
+
 namespace TRIO
 {
     namespace Private
@@ -126,6 +139,56 @@ namespace TRIO
                 static void Run(){ }
             };
             
+        #if TRIO_FOLD_EXPRESSIONS
+            template< class... Ts >
+            struct TypePack{ };
+
+            //Convert typelist to parameter pack
+            template< class LIST, class... Ts >
+            struct MakeTypePack{ typedef TypePack<Ts...> Result; };
+
+            template< class Head, class Tail, class... Ts >
+            struct MakeTypePack< Loki::Typelist<Head, Tail>, Ts... >
+            {
+                typedef typename MakeTypePack<Tail, Ts..., Head>::Result Result;
+            };
+
+            template< class PACK, template<class T,class U,uint32_t N,uint32_t M>class Fn, class FnU, uint32_t FnN, uint32_t FnM >
+            struct runForEachPack;
+
+            template< class... Ts, template<class T,class U,uint32_t N,uint32_t M>class Fn, class FnU, uint32_t FnN, uint32_t FnM >
+            struct runForEachPack< TypePack<Ts...>, Fn, FnU, FnN, FnM >
+            {
+                template< class RtT, class RtU, class RtV >
+                PL_INLINE_PRAGMA
+                static void RunIIO(const RtT InPar1, const RtU InPar2, RtV &outPar){ ( Fn<Ts, FnU, FnN, FnM>::RunIIO( InPar1, InPar2, outPar ), ... ); }
+
+                template< class RtT, class RtV >
+                PL_INLINE_PRAGMA
+                static void RunIO(const RtT InPar1, RtV &outPar){ ( Fn<Ts, FnU, FnN, FnM>::RunIO( InPar1, outPar ), ... ); }
+
+                template< class RtU >
+                PL_INLINE_PRAGMA
+                static void RunO( RtU &OutPar1 ){ ( Fn<Ts, FnU, FnN, FnM>::RunO( OutPar1 ), ... ); }
+
+                template< class RtT, class RtU >
+                PL_INLINE_PRAGMA
+                static void RunII(const RtT InPar1, const RtU InPar2){ ( Fn<Ts, FnU, FnN, FnM>::RunII( InPar1, InPar2 ), ... ); }
+
+                template< class RtT >
+                PL_INLINE_PRAGMA
+                static void RunI(const RtT InPar1){ ( Fn<Ts, FnU, FnN, FnM>::RunI( InPar1 ), ... ); }
+
+                PL_INLINE_PRAGMA
+                static void Run(){ ( Fn<Ts, FnU, FnN, FnM>::Run(), ... ); }
+            };
+
+			template< class Head, class Tail, template<class T,class U,uint32_t N, uint32_t M>class Fn, class FnU, uint32_t FnN, uint32_t FnM >
+            struct runForEach< Loki::Typelist<Head, Tail>, Fn, FnU, FnN, FnM >
+                : public runForEachPack< typename MakeTypePack< Loki::Typelist<Head, Tail> >::Result, Fn, FnU, FnN, FnM >
+            {
+            };
+        #else
 			template< class Head, class Tail, template<class T,class U,uint32_t N, uint32_t M>class Fn, class FnU, uint32_t FnN, uint32_t FnM >
             struct runForEach< Loki::Typelist<Head, Tail>, Fn, FnU, FnN, FnM >
             {
@@ -181,6 +244,7 @@ namespace TRIO
                     runForEach<Tail, Fn, FnU, FnN, FnM>::Run();
                 }
             };
+        #endif
 
             /*Call meta function(not a method!) MetaFn for each element in the LIST
 			* Performs BITWISE OR on meta function return value on each iteration.
@@ -309,9 +373,68 @@ namespace TRIO
                 typedef typename List1MinusList2< typename Loki::TL::EraseAll<LIST1, Head>::Result, Tail >::Result Result;
             };
             //======================Algorithms END==========================
+
+            //Index of least significant 1 bit. value must not be 0
+            inline uint8_t CountTrailingZeros(uint32_t value)
+            {
+            #if defined(__GNUC__)
+                return (uint8_t)__builtin_ctzl( (unsigned long)value );	//unsigned long is 32 bits at least, int is 16 bits on AVR
+            #else
+                //De Bruijn sequence multiplication
+                static const uint8_t Position[32] =
+                {
+                    0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+                    31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+                };
+                return Position[ (uint32_t)((value & (0U - value)) * 0x077CB531UL) >> 27 ];
+            #endif
+            }
         }//namespace Utils
     }//namespace Private
 }//namespace TRIO
 
+/*Constant tables generated from typelists at compile time.
+* C++03 aggregate initializer must be written out, so table is specialized for each length 1..32.
+* TRIO_TABLE_INIT_N(E) expands to E(0), E(1) ... E(N-1)
+* TRIO_TABLE_FOR_LENGTHS(M) expands to M(1) M(2) ... M(32)*/
+#define TRIO_TABLE_INIT_1(E)	E(0)
+#define TRIO_TABLE_INIT_2(E)	TRIO_TABLE_INIT_1(E), E(1)
+#define TRIO_TABLE_INIT_3(E)	TRIO_TABLE_INIT_2(E), E(2)
+#define TRIO_TABLE_INIT_4(E)	TRIO_TABLE_INIT_3(E), E(3)
+#define TRIO_TABLE_INIT_5(E)	TRIO_TABLE_INIT_4(E), E(4)
+#define TRIO_TABLE_INIT_6(E)	TRIO_TABLE_INIT_5(E), E(5)
+#define TRIO_TABLE_INIT_7(E)	TRIO_TABLE_INIT_6(E), E(6)
+#define TRIO_TABLE_INIT_8(E)	TRIO_TABLE_INIT_7(E), E(7)
+#define TRIO_TABLE_INIT_9(E)	TRIO_TABLE_INIT_8(E), E(8)
+#define TRIO_TABLE_INIT_10(E)	TRIO_TABLE_INIT_9(E), E(9)
+#define TRIO_TABLE_INIT_11(E)	TRIO_TABLE_INIT_10(E), E(10)
+#define TRIO_TABLE_INIT_12(E)	TRIO_TABLE_INIT_11(E), E(11)
+#define TRIO_TABLE_INIT_13(E)	TRIO_TABLE_INIT_12(E), E(12)
+#define TRIO_TABLE_INIT_14(E)	TRIO_TABLE_INIT_13(E), E(13)
+#define TRIO_TABLE_INIT_15(E)	TRIO_TABLE_INIT_14(E), E(14)
+#define TRIO_TABLE_INIT_16(E)	TRIO_TABLE_INIT_15(E), E(15)
+#define TRIO_TABLE_INIT_17(E)	TRIO_TABLE_INIT_16(E), E(16)
+#define TRIO_TABLE_INIT_18(E)	TRIO_TABLE_INIT_17(E), E(17)
+#define TRIO_TABLE_INIT_19(E)	TRIO_TABLE_INIT_18(E), E(18)
+#define TRIO_TABLE_INIT_20(E)	TRIO_TABLE_INIT_19(E), E(19)
+#define TRIO_TABLE_INIT_21(E)	TRIO_TABLE_INIT_20(E), E(20)
+#define TRIO_TABLE_INIT_22(E)	TRIO_TABLE_INIT_21(E), E(21)
+#define TRIO_TABLE_INIT_23(E)	TRIO_TABLE_INIT_22(E), E(22)
+#define TRIO_TABLE_INIT_24(E)	TRIO_TABLE_INIT_23(E), E(23)
+#define TRIO_TABLE_INIT_25(E)	TRIO_TABLE_INIT_24(E), E(24)
+#define TRIO_TABLE_INIT_26(E)	TRIO_TABLE_INIT_25(E), E(25)
+#define TRIO_TABLE_INIT_27(E)	TRIO_TABLE_INIT_26(E), E(26)
+#define TRIO_TABLE_INIT_28(E)	TRIO_TABLE_INIT_27(E), E(27)
+#define TRIO_TABLE_INIT_29(E)	TRIO_TABLE_INIT_28(E), E(28)
+#define TRIO_TABLE_INIT_30(E)	TRIO_TABLE_INIT_29(E), E(29)
+#define TRIO_TABLE_INIT_31(E)	TRIO_TABLE_INIT_30(E), E(30)
+#define TRIO_TABLE_INIT_32(E)	TRIO_TABLE_INIT_31(E), E(31)
+
+#define TRIO_TABLE_FOR_LENGTHS(M) \
+    M(1) M(2) M(3) M(4) M(5) M(6) M(7) M(8) \
+    M(9) M(10) M(11) M(12) M(13) M(14) M(15) M(16) \
+    M(17) M(18) M(19) M(20) M(21) M(22) M(23) M(24) \
+    M(25) M(26) M(27) M(28) M(29) M(30) M(31) M(32)
+
 #endif //TRIO_PINLIST_UTILS_HPP_
 
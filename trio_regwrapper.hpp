@@ -42,5 +42,57 @@
 		static void AndOr(RegDataT andMask, RegDataT orMask){REG_NAME = (REG_NAME & andMask) | orMask;}\
 	}
 
+namespace TRIO
+{
+    namespace Private
+    {
+        //Register that doesn't exist. Writes are ignored, reads give 0.
+        //Ports without GPIO clock gating use it as ClockEnableReg
+        struct NullRegister
+        {
+            typedef uint32_t RegDataT;
+            static RegDataT Value(){ return 0; }
+            static void Set(RegDataT value){ }
+            static void Or(RegDataT value){ }
+            static void And(RegDataT value){ }
+            static void Xor(RegDataT value){ }
+            static void AndOr(RegDataT andMask, RegDataT orMask){ }
+        };
+
+        /*Register write staging for IO_REG_WRAPPER classes.
+        * Or()/And() calls are accumulated in RAM and Commit() applies all of them
+        * with one read and one write of the register. Last call wins for the same bit.
+        * REG - class made by IO_REG_WRAPPER macro*/
+        template< class REG >
+        class StagedRegWrite
+        {
+            typedef typename REG::RegDataT RegDataT;
+            RegDataT touchedBits;   //bits we are going to change
+            RegDataT newBits;       //new values for touchedBits
+        public:
+            StagedRegWrite(): touchedBits(0), newBits(0){ }
+
+            void Or(RegDataT value)
+            {
+                touchedBits |= value;
+                newBits |= value;
+            }
+            void And(RegDataT value)
+            {
+                touchedBits |= (RegDataT)~value;
+                newBits &= value;
+            }
+            void Commit()
+            {
+                if( touchedBits )   //don't touch register if there was nothing staged
+                    REG::AndOr( (RegDataT)~touchedBits, newBits );
+                touchedBits = 0;
+                newBits = 0;
+            }
+            void Cancel(){ touchedBits = 0; newBits = 0; }
+        };
+    }//namespace Private
+}//namespace TRIO
+
 #endif
 
@@ -60,20 +60,33 @@ namespace TRIO
     		static void Set(bool val)
     		{
     			if( val )
-                    PORT::template Set<MASK>();
+                    Set();
     			else
-    				PORT::template Clear<MASK>();
+    				Clear();
     		}
     		
-			static void Set(){ Set(true); }
+			static void Set()
+			{
+				TRIO_LATENCY_PROBE( TPinImplementation, "TPin::Set" );
+				PORT::template Set<MASK>();
+			}
     		
-			static void Clear(){ Set(false); }
+			static void Clear()
+			{
+				TRIO_LATENCY_PROBE( TPinImplementation, "TPin::Clear" );
+				PORT::template Clear<MASK>();
+			}
     		
-			static void Toggle(){ PORT::template Toggle<MASK>(); }
+			static void Toggle()
+			{
+				TRIO_LATENCY_PROBE( TPinImplementation, "TPin::Toggle" );
+				PORT::template Toggle<MASK>();
+			}
     		
 			static bool IsSet()
 			{ 
-				return PORT::Read() & MASK;
+				TRIO_LATENCY_PROBE( TPinImplementation, "TPin::IsSet" );
+				return PORT::template Read<MASK>() != 0;
 			}
 
             struct Configure
@@ -131,18 +144,27 @@ namespace TRIO
     		static void Set(bool val)
     		{
     			if( val )
-    				PORT::template Clear<MASK>();
+    				Set();
     			else
-    				PORT::template Set<MASK>();
+    				Clear();
     		}
     		
-			static void Set(){	Set(true); }
+			static void Set()
+			{
+				TRIO_LATENCY_PROBE( InvertedPinImplementation, "TPin::Set" );
+				PORT::template Clear<MASK>();
+			}
     		
-			static void Clear(){ Set(false); }
+			static void Clear()
+			{
+				TRIO_LATENCY_PROBE( InvertedPinImplementation, "TPin::Clear" );
+				PORT::template Set<MASK>();
+			}
             
 			static bool IsSet()
 			{ 
-				return !(PORT::PinRead() & MASK);
+				TRIO_LATENCY_PROBE( InvertedPinImplementation, "TPin::IsSet" );
+				return PORT::template Read<MASK>() == 0;
 			}
 
     	};//class InvertedPinImplementation
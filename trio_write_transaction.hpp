@@ -0,0 +1,167 @@
+//*****************************************************************************
+//
+// Author		: Trotzky Vasily
+// Date			: oct 2026
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation and/or
+// other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+// IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+// INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+// Coalesce writes of several PinLists and pins sharing physical ports.
+// Each PinList or pin write is its own port access, so strobe sequences like "data bus, then RS, then E"
+// touch the same port several times. Transaction stages writes in RAM and Commit() does one
+// ClearAndSet(set/reset store where port has it) per touched port.
+//
+// Members are flattened into one PinList at compile time, so ports involved and member masks
+// in each port are known at compile time. At runtime only two masks are kept.
+// Members must not share physical pins(inverted or not), this is checked at compile time: each member pin has its own
+// staged bit, so writes of two members to one pin could not be ordered. For pins of one member the last staged write wins.
+// Nothing is written to hardware until Commit(). Cancel() drops staged writes.
+//
+// Usage example:
+// typedef PinList<Pb0, Pb1, Pb2, Pb3> LcdData;
+// Transaction<LcdData, LcdRs, LcdE> tr;
+// tr.Write<LcdData>( nibble );
+// tr.Set<LcdRs>();
+// tr.Set<LcdE>();
+// tr.Commit();				//one port B access if all of them are on port B
+
+#ifndef TRIO_WRITE_TRANSACTION_HPP_
+#define TRIO_WRITE_TRANSACTION_HPP_
+
+#ifndef TRIO_HPP_
+    #error "Do not include this file directly. Use #include\"trio.hpp\" instead!"
+#endif
+
+#include <stdint.h>
+#include "loki/Typelist.h"
+#include "boost_static_assert.h"
+#include "trio_pinlist.hpp"
+
+namespace TRIO
+{
+    namespace Private
+    {
+        //Position of MEMBER first pin in flattened list of members pins
+        template< class MEMBERS, class MEMBER >
+        struct TransactionMemberOffset;
+
+        template< class Tail, class MEMBER >
+        struct TransactionMemberOffset< Loki::Typelist<MEMBER, Tail>, MEMBER >
+        {
+            static const uint8_t value = 0;
+        };
+
+        template< class Head, class Tail, class MEMBER >
+        struct TransactionMemberOffset< Loki::Typelist<Head, Tail>, MEMBER >
+        {
+            static const uint8_t value = Loki::TL::Length< typename PinListElementPins<Head>::Result >::value
+                                       + TransactionMemberOffset<Tail, MEMBER>::value;
+        };
+
+        //True if PINS has physical pin PIN: same port and pin number, inversion does not matter
+        template< class PINS, class PIN >
+        struct TransactionHasPin{ enum{ value = false }; };
+
+        template< class Head, class Tail, class PIN >
+        struct TransactionHasPin< Loki::Typelist<Head, Tail>, PIN >
+        {
+            enum{ value = ( Loki::IsSameType<typename Head::TRIOInternals::Port, typename PIN::TRIOInternals::Port>::value
+                            && Head::TRIOInternals::PortPinNumber == PIN::TRIOInternals::PortPinNumber )
+                          || TransactionHasPin<Tail, PIN>::value };
+        };
+
+        //True if some physical pin is in PINS more than once
+        template< class PINS >
+        struct TransactionSharedPins{ enum{ value = false }; };
+
+        template< class Head, class Tail >
+        struct TransactionSharedPins< Loki::Typelist<Head, Tail> >
+        {
+            enum{ value = TransactionHasPin<Tail, Head>::value || TransactionSharedPins<Tail>::value };
+        };
+    }//namespace Private
+
+    template<
+        typename T1  = Loki::NullType, typename T2  = Loki::NullType, typename T3  = Loki::NullType,
+        typename T4  = Loki::NullType, typename T5  = Loki::NullType, typename T6  = Loki::NullType,
+        typename T7  = Loki::NullType, typename T8  = Loki::NullType, typename T9  = Loki::NullType,
+        typename T10 = Loki::NullType, typename T11 = Loki::NullType, typename T12 = Loki::NullType,
+        typename T13 = Loki::NullType, typename T14 = Loki::NullType, typename T15 = Loki::NullType,
+        typename T16 = Loki::NullType >
+    class Transaction
+    {
+        typedef typename Loki::TL::MakeTypelist<T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16>::Result	Members;
+
+    public:
+        //All pins of all members
+        typedef PinList<T1,T2,T3,T4,T5,T6,T7,T8,T9,T10,T11,T12,T13,T14,T15,T16>	Pins;
+        typedef typename Pins::DataT DataT;
+
+    private:
+        //Same pin in two members(or twice in one member)
+        BOOST_STATIC_ASSERT( !(Private::TransactionSharedPins< typename Private::PinListElementPins<Pins>::Result >::value) );
+
+        //MEMBER pins mask and position in Pins
+        template< class MEMBER >
+        struct Member
+        {
+            BOOST_STATIC_ASSERT( (Loki::TL::IndexOf<Members, MEMBER>::value >= 0) );	//MEMBER is not in Transaction
+
+            static const uint8_t Offset = Private::TransactionMemberOffset<Members, MEMBER>::value;
+            static const uint8_t Length = Loki::TL::Length< typename Private::PinListElementPins<MEMBER>::Result >::value;
+            static const DataT Mask = (DataT)( (Length >= 32 ? 0xFFFFFFFFUL : ((1UL << (Length & 31)) - 1)) << Offset );
+        };
+
+        DataT _clear;
+        DataT _set;
+
+        void Stage(const DataT mask, const DataT value)
+        {
+            _clear = (DataT)( (_clear & ~mask) | (mask & ~value) );
+            _set = (DataT)( (_set & ~mask) | (mask & value) );
+        }
+
+    public:
+        Transaction(): _clear(0), _set(0){ }
+
+        //Stage write of member value(bool for pin)
+        template< class MEMBER >
+        void Write(uint32_t value){ Stage( Member<MEMBER>::Mask, (DataT)(value << Member<MEMBER>::Offset) ); }
+
+        //Stage set or clear of member pins in mask(all member pins by default)
+        template< class MEMBER >
+        void Set(uint32_t mask = 0xFFFFFFFFUL){ Stage( (DataT)(Member<MEMBER>::Mask & (mask << Member<MEMBER>::Offset)), Member<MEMBER>::Mask ); }
+        template< class MEMBER >
+        void Clear(uint32_t mask = 0xFFFFFFFFUL){ Stage( (DataT)(Member<MEMBER>::Mask & (mask << Member<MEMBER>::Offset)), 0 ); }
+
+        //One ClearAndSet per port which pins are staged
+        void Commit()
+        {
+            Pins::ClearAndSet( _clear, _set );
+            Cancel();
+        }
+
+        void Cancel(){ _clear = 0; _set = 0; }
+    };
+}//namespace TRIO
+
+#endif//TRIO_WRITE_TRANSACTION_HPP_